@@ -0,0 +1,121 @@
+/*
+  CentiTemp - Helpers for temperatures kept as hundredths of a degree.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include "CentiTemp.h"
+
+#include <ParseUtils.h>
+
+/**
+ * Used to bring the given centi-degrees into the range an int16_t holds.
+ *
+ * @param centi The temperature in centi-degrees as int32_t.
+ *
+ * @return Returns the clamped temperature in centi-degrees as int16_t.
+*/
+int16_t CentiTemp::clamp(int32_t centi) {
+    if (centi > INT16_MAX) {
+
+        return INT16_MAX;
+    }
+    if (centi < INT16_MIN) {
+
+        return INT16_MIN;
+    }
+
+    return (int16_t) centi;
+}
+
+/**
+ * Used to convert a temperature in degrees into centi-degrees, rounding to
+ * the nearest. This is for where a float can't be avoided, such as numbers
+ * that ArduinoJson has already parsed.
+ *
+ * @param temp The temperature in degrees as float.
+ *
+ * @return Returns the temperature in centi-degrees as int16_t.
+*/
+int16_t CentiTemp::fromFloat(float temp) {
+    float centi = temp * 100.0f;
+    if (centi >= (float) INT16_MAX) {
+
+        return INT16_MAX;
+    }
+    if (centi <= (float) INT16_MIN) {
+
+        return INT16_MIN;
+    }
+
+    return (int16_t) (centi < 0.0f ? centi - 0.5f : centi + 0.5f);
+}
+
+/**
+ * Used to convert centi-degrees into degrees.
+ *
+ * @param centi The temperature in centi-degrees as int16_t.
+ *
+ * @return Returns the temperature in degrees as float.
+*/
+float CentiTemp::toFloat(int16_t centi) {
+
+    return centi / 100.0f;
+}
+
+/**
+ * Used to convert a Celsius temperature into Fahrenheit, both in centi-degrees,
+ * rounding to the nearest.
+ *
+ * @param centiC The temperature in centi-degrees Celsius as int16_t.
+ *
+ * @return Returns the temperature in centi-degrees Fahrenheit as int16_t.
+*/
+int16_t CentiTemp::celsiusToFahrenheit(int16_t centiC) {
+    int32_t scaled = (int32_t) centiC * 9;
+    // FYI: Division truncates toward zero so round away from it by hand...
+    int32_t centiF = (scaled >= 0 ? scaled + 2 : scaled - 2) / 5 + 3200;
+
+    return clamp(centiF);
+}
+
+/**
+ * Used to parse a decimal temperature such as 71.6, -3 or .25 into
+ * centi-degrees without going through a float. Digits past the hundredths are
+ * rounded off.
+ *
+ * @param text The text to parse as char pointer.
+ * @param centi Receives the temperature in centi-degrees as int16_t reference.
+ *
+ * @return Returns true if the text was a temperature in range otherwise false as bool.
+*/
+bool CentiTemp::parse(const char *text, int16_t &centi) {
+    long value = 0L;
+    if (
+        ParseUtils::parseFixed(text, 2U, value) != ParseUtils::NUMBER_OK
+        || value > INT16_MAX
+        || value < INT16_MIN
+    ) { // Not a number or out of range...
+
+        return false;
+    }
+    centi = (int16_t) value;
+
+    return true;
+}
+
+/**
+ * Used to format centi-degrees as a decimal temperature, leaving off trailing
+ * zeros in the fraction, so 7160 is 71.6 and 7200 is 72.
+ *
+ * @param centi The temperature in centi-degrees as int16_t.
+ * @param buffer The buffer to write into, CENTI_TEMP_TEXT_SIZE being enough, as char pointer.
+ * @param size The size of the buffer as size_t.
+ *
+ * @return Returns the length written, zero if it didn't fit, as size_t.
+*/
+size_t CentiTemp::format(int16_t centi, char *buffer, size_t size) {
+
+    return ParseUtils::formatFixed(centi, 2U, true, buffer, size);
+}
@@ -0,0 +1,38 @@
+#ifndef CentiTemp_h
+    #define CentiTemp_h
+
+    #include <stddef.h>
+    #include <stdint.h>
+
+    #define CENTI_TEMP_TEXT_SIZE 8U // Longest formatted temperature, -327.68, + 1 null
+
+    /*
+      CLASS: CentiTemp
+
+      This class holds the helpers for temperatures kept as centi-degrees, that is
+      hundredths of a degree in an int16_t, so 71.6 is 7160. The ESP8266 has no
+      FPU, so keeping temperatures as integers makes comparing, converting,
+      parsing and formatting them plain integer work instead of going through
+      soft-float routines. An int16_t covers -327.68 to 327.67 which is plenty for
+      a room; anything outside that is clamped.
+
+      Only the PID controller and the poll interval, which work in rates and
+      gains, still take temperatures as floats, by way of toFloat().
+
+      Written by: Scott Griffis
+      Date: 10-16-2026
+    */
+    class CentiTemp {
+        private:
+            CentiTemp();
+
+        public:
+            static int16_t clamp(int32_t centi);
+            static int16_t fromFloat(float temp);
+            static float toFloat(int16_t centi);
+            static int16_t celsiusToFahrenheit(int16_t centiC);
+            static bool parse(const char *text, int16_t &centi);
+            static size_t format(int16_t centi, char *buffer, size_t size);
+    };
+
+#endif
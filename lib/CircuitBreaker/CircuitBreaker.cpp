@@ -0,0 +1,184 @@
+/*
+  CircuitBreaker - Stops a failing remote from being tried over and over by
+  backing off exponentially and probing before trying it again in earnest.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include "CircuitBreaker.h"
+
+// Name of each state in the same order as State...
+static const char *STATE_NAMES[] = {
+    "closed",
+    "open",
+    "half_open"
+};
+
+/**
+ * #### CLASS CONSTRUCTOR ####
+ * Allows for external instantiation of
+ * the class into an object.
+*/
+CircuitBreaker::CircuitBreaker() {
+    state = CLOSED;
+    consecutiveFailures = 0U;
+    backoffLevel = 0U;
+    openedAt = 0UL;
+    backoffMillis = 0UL;
+    tripCount = 0UL;
+}
+
+/**
+ * Used to ask if an attempt may be made now. When the breaker is OPEN and its
+ * backoff has passed it goes HALF_OPEN and this single attempt is allowed as
+ * the probe; no more are allowed until the probe's outcome is recorded.
+ *
+ * @param now The current time in milliseconds as unsigned long.
+ *
+ * @return Returns true if an attempt may be made otherwise false as bool.
+*/
+bool CircuitBreaker::allow(unsigned long now) {
+    switch (state) {
+        case CLOSED:
+
+            return true;
+        case OPEN:
+            if (now - openedAt >= backoffMillis) { // Time to probe...
+                state = HALF_OPEN;
+
+                return true;
+            }
+
+            return false;
+        default: // Probe is still outstanding...
+
+            return false;
+    }
+}
+
+/**
+ * Used to record that an attempt succeeded, which closes the breaker and
+ * resets its backoff.
+*/
+void CircuitBreaker::recordSuccess() {
+    state = CLOSED;
+    consecutiveFailures = 0U;
+    backoffLevel = 0U;
+}
+
+/**
+ * Used to record that an attempt failed. A failed probe, or reaching
+ * CIRCUIT_BREAKER_THRESHOLD failures in a row, opens the breaker.
+ *
+ * @param now The current time in milliseconds as unsigned long.
+*/
+void CircuitBreaker::recordFailure(unsigned long now) {
+    if (consecutiveFailures < UINT8_MAX) {
+        consecutiveFailures++;
+    }
+    if (state == HALF_OPEN || consecutiveFailures >= CIRCUIT_BREAKER_THRESHOLD) {
+        trip(now);
+    }
+}
+
+/**
+ * Used to put the breaker back to CLOSED as if nothing had failed, such as
+ * when the remote it guards is changed.
+*/
+void CircuitBreaker::reset() {
+    state = CLOSED;
+    consecutiveFailures = 0U;
+    backoffLevel = 0U;
+    backoffMillis = 0UL;
+}
+
+/**
+ * Used to get the state of the breaker.
+ *
+ * @return Returns the state as State.
+*/
+CircuitBreaker::State CircuitBreaker::getState() {
+
+    return state;
+}
+
+/**
+ * Used to get the number of attempts that have failed in a row.
+ *
+ * @return Returns the count as uint8_t.
+*/
+uint8_t CircuitBreaker::getConsecutiveFailures() {
+
+    return consecutiveFailures;
+}
+
+/**
+ * Used to get how long until the breaker allows its next probe.
+ *
+ * @param now The current time in milliseconds as unsigned long.
+ *
+ * @return Returns the time in milliseconds, or zero if not OPEN, as unsigned long.
+*/
+unsigned long CircuitBreaker::getRetryInMillis(unsigned long now) {
+    if (state != OPEN || now - openedAt >= backoffMillis) { // Not waiting...
+
+        return 0UL;
+    }
+
+    return backoffMillis - (now - openedAt);
+}
+
+/**
+ * Used to get the number of times the breaker has opened.
+ *
+ * @return Returns the count as unsigned long.
+*/
+unsigned long CircuitBreaker::getTripCount() {
+
+    return tripCount;
+}
+
+/**
+ * Used to get the name of the given state as used by the status API.
+ *
+ * @param state The state as State.
+ *
+ * @return Returns the name as char pointer.
+*/
+const char* CircuitBreaker::getStateName(State state) {
+
+    return STATE_NAMES[state];
+}
+
+/*
+=================================================================
+Private Functions
+=================================================================
+*/
+
+/**
+ * #### PRIVATE ####
+ * Opens the breaker, doubling the backoff from the last time it opened.
+ *
+ * @param now The current time in milliseconds as unsigned long.
+*/
+void CircuitBreaker::trip(unsigned long now) {
+    unsigned long backoff = CIRCUIT_BREAKER_BASE_MS;
+    for (uint8_t i = 0U; i < backoffLevel && backoff < CIRCUIT_BREAKER_MAX_MS; i++) {
+        backoff *= 2UL;
+    }
+    if (backoff >= CIRCUIT_BREAKER_MAX_MS) { // Reached the cap...
+        backoff = CIRCUIT_BREAKER_MAX_MS;
+    } else {
+        backoffLevel++;
+    }
+
+    // Jitter by up to a quarter either way...
+    unsigned long spread = backoff / 4UL;
+    backoffMillis = backoff - spread + (ESP.random() % (2UL * spread + 1UL));
+
+    state = OPEN;
+    openedAt = now;
+    tripCount++;
+}
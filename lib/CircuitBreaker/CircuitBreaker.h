@@ -0,0 +1,69 @@
+#ifndef CircuitBreaker_h
+    #define CircuitBreaker_h
+
+    #include <Arduino.h>
+
+    #ifndef CIRCUIT_BREAKER_THRESHOLD
+        #define CIRCUIT_BREAKER_THRESHOLD 3U // Failures in a row that open the breaker
+    #endif
+
+    #ifndef CIRCUIT_BREAKER_BASE_MS
+        #define CIRCUIT_BREAKER_BASE_MS 15000UL // How long the breaker first stays open
+    #endif
+
+    #ifndef CIRCUIT_BREAKER_MAX_MS
+        #define CIRCUIT_BREAKER_MAX_MS 600000UL // Longest the breaker stays open
+    #endif
+
+    /*
+      CLASS: CircuitBreaker
+
+      This class keeps a failing remote from being tried over and over. It starts
+      CLOSED, where every attempt is allowed. After CIRCUIT_BREAKER_THRESHOLD
+      failures in a row it goes OPEN and no attempts are allowed until its backoff
+      has passed. The backoff starts at CIRCUIT_BREAKER_BASE_MS and doubles each
+      time the breaker opens again, up to CIRCUIT_BREAKER_MAX_MS, and is jittered
+      by up to a quarter either way so several breakers don't retry in step.
+
+      Once the backoff has passed the breaker goes HALF_OPEN and allows a single
+      probe. If the probe succeeds the breaker closes and the backoff is reset,
+      otherwise it opens again for longer.
+
+      Written by: Scott Griffis
+      Date: 10-16-2026
+    */
+    class CircuitBreaker {
+        public:
+            enum State : uint8_t {
+                CLOSED = 0,
+                OPEN,
+                HALF_OPEN
+            };
+
+        private:
+            State          state                  ;
+            uint8_t        consecutiveFailures    ;
+            uint8_t        backoffLevel           ;
+            unsigned long  openedAt               ;
+            unsigned long  backoffMillis          ;
+            unsigned long  tripCount              ;
+
+            void trip(unsigned long now);
+
+        public:
+            CircuitBreaker();
+
+            bool allow(unsigned long now);
+            void recordSuccess();
+            void recordFailure(unsigned long now);
+            void reset();
+
+            State          getState                 ();
+            uint8_t        getConsecutiveFailures   ();
+            unsigned long  getRetryInMillis         (unsigned long now);
+            unsigned long  getTripCount             ();
+
+            static const char* getStateName(State state);
+    };
+
+#endif
@@ -0,0 +1,274 @@
+/*
+  CoopScheduler - Runs the device's work as cooperative tasks with periods,
+  priorities and deadlines, idling in between instead of a fixed delay.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include "CoopScheduler.h"
+
+// Name of each priority in the same order as Priority...
+static const char *PRIORITY_NAMES[] = {
+    "critical",
+    "elevated",
+    "normal",
+    "background"
+};
+
+/**
+ * #### CLASS CONSTRUCTOR ####
+ * Allows for external instantiation of
+ * the class into an object.
+*/
+CoopScheduler::CoopScheduler() {
+    taskCount = 0U;
+    idleMillis = 0UL;
+}
+
+/**
+ * Used to add a task. Tasks of the same priority run in the order they were
+ * added. A task is first due right away and its period is counted from when
+ * it first runs.
+ *
+ * @param name The name of the task, which must outlive the scheduler, as char pointer.
+ * @param function The function to run, returning true while it has more work in hand, as TaskFunction.
+ * @param periodMillis How often to run the task, zero being every pass, as unsigned long.
+ * @param priority The priority of the task as Priority.
+ * @param deadlineMillis How long after becoming due the task should have finished as unsigned long.
+ *
+ * @return Returns true if added or false if there is no room as bool.
+*/
+bool CoopScheduler::addTask(const char *name, TaskFunction function, unsigned long periodMillis, Priority priority, unsigned long deadlineMillis) {
+    if (taskCount >= COOP_SCHEDULER_MAX_TASKS) { // No room...
+
+        return false;
+    }
+
+    // Keep the tasks in priority order...
+    uint8_t index = taskCount;
+    while (index > 0U && tasks[index - 1U].priority > priority) {
+        tasks[index] = tasks[index - 1U];
+        index--;
+    }
+
+    Task &task = tasks[index];
+    task.name = name;
+    task.function = function;
+    task.periodMillis = periodMillis;
+    task.deadlineMillis = deadlineMillis;
+    task.priority = priority;
+    task.nextRunAt = millis();
+    task.runCount = 0UL;
+    task.overrunCount = 0UL;
+    task.skipCount = 0UL;
+    task.worstMicros = 0UL;
+    task.lastMicros = 0UL;
+    taskCount++;
+
+    return true;
+}
+
+/**
+ * Used to make one pass over the tasks, running each that is due in priority
+ * order, then to idle until the next is due. This is intended to be the only
+ * thing called from the loop.
+*/
+void CoopScheduler::run() {
+    for (uint8_t i = 0U; i < taskCount; i++) {
+        if ((long) (millis() - tasks[i].nextRunAt) >= 0L) { // Task is due...
+            runTask(tasks[i]);
+        }
+    }
+
+    // Work out how long until something is due...
+    unsigned long now = millis();
+    unsigned long wait = COOP_SCHEDULER_SLEEP_MAX_MS;
+    for (uint8_t i = 0U; i < taskCount && wait > 0UL; i++) {
+        long until = (long) (tasks[i].nextRunAt - now);
+        if (until <= 0L) { // Already due...
+            wait = 0UL;
+        } else if ((unsigned long) until < wait) {
+            wait = (unsigned long) until;
+        }
+    }
+
+    if (wait >= COOP_SCHEDULER_SLEEP_MIN_MS) { // Long enough to sleep...
+        delay(wait);
+        idleMillis += wait;
+    } else {
+        yield();
+    }
+}
+
+/**
+ * Used to get the number of tasks.
+ *
+ * @return Returns the count as uint8_t.
+*/
+uint8_t CoopScheduler::getTaskCount() {
+
+    return taskCount;
+}
+
+/**
+ * Used to get the name of a task. Tasks are indexed in priority order.
+ *
+ * @param index The index of the task as uint8_t.
+ *
+ * @return Returns the name as char pointer.
+*/
+const char* CoopScheduler::getTaskName(uint8_t index) {
+
+    return (index < taskCount ? tasks[index].name : "");
+}
+
+/**
+ * Used to get the period of a task.
+ *
+ * @param index The index of the task as uint8_t.
+ *
+ * @return Returns the period in milliseconds as unsigned long.
+*/
+unsigned long CoopScheduler::getTaskPeriodMillis(uint8_t index) {
+
+    return (index < taskCount ? tasks[index].periodMillis : 0UL);
+}
+
+/**
+ * Used to get the priority of a task.
+ *
+ * @param index The index of the task as uint8_t.
+ *
+ * @return Returns the priority as Priority.
+*/
+CoopScheduler::Priority CoopScheduler::getTaskPriority(uint8_t index) {
+
+    return (index < taskCount ? tasks[index].priority : BACKGROUND);
+}
+
+/**
+ * Used to get the number of times a task has run.
+ *
+ * @param index The index of the task as uint8_t.
+ *
+ * @return Returns the count as unsigned long.
+*/
+unsigned long CoopScheduler::getTaskRunCount(uint8_t index) {
+
+    return (index < taskCount ? tasks[index].runCount : 0UL);
+}
+
+/**
+ * Used to get the number of runs of a task that finished past its deadline.
+ *
+ * @param index The index of the task as uint8_t.
+ *
+ * @return Returns the count as unsigned long.
+*/
+unsigned long CoopScheduler::getTaskOverrunCount(uint8_t index) {
+
+    return (index < taskCount ? tasks[index].overrunCount : 0UL);
+}
+
+/**
+ * Used to get the number of periods of a task that passed in full before it
+ * got to run.
+ *
+ * @param index The index of the task as uint8_t.
+ *
+ * @return Returns the count as unsigned long.
+*/
+unsigned long CoopScheduler::getTaskSkipCount(uint8_t index) {
+
+    return (index < taskCount ? tasks[index].skipCount : 0UL);
+}
+
+/**
+ * Used to get the longest a task has taken to run.
+ *
+ * @param index The index of the task as uint8_t.
+ *
+ * @return Returns the time in microseconds as unsigned long.
+*/
+unsigned long CoopScheduler::getTaskWorstMicros(uint8_t index) {
+
+    return (index < taskCount ? tasks[index].worstMicros : 0UL);
+}
+
+/**
+ * Used to get how long the most recent run of a task took.
+ *
+ * @param index The index of the task as uint8_t.
+ *
+ * @return Returns the time in microseconds as unsigned long.
+*/
+unsigned long CoopScheduler::getTaskLastMicros(uint8_t index) {
+
+    return (index < taskCount ? tasks[index].lastMicros : 0UL);
+}
+
+/**
+ * Used to get the total time spent sleeping while nothing was due.
+ *
+ * @return Returns the time in milliseconds as unsigned long.
+*/
+unsigned long CoopScheduler::getIdleMillis() {
+
+    return idleMillis;
+}
+
+/**
+ * Used to get the name of the given priority as used by the status API.
+ *
+ * @param priority The priority as Priority.
+ *
+ * @return Returns the name as char pointer.
+*/
+const char* CoopScheduler::getPriorityName(Priority priority) {
+
+    return PRIORITY_NAMES[priority];
+}
+
+/*
+=================================================================
+Private Functions
+=================================================================
+*/
+
+/**
+ * #### PRIVATE ####
+ * Runs the given task, keeping its accounting, and works out when it is
+ * next due.
+ *
+ * @param task The task to run as Task reference.
+*/
+void CoopScheduler::runTask(Task &task) {
+    unsigned long dueAt = task.nextRunAt;
+    if (task.runCount == 0UL) { // First run, so nothing was missed...
+        dueAt = millis();
+    }
+    unsigned long started = micros();
+    bool moreWork = task.function();
+    unsigned long took = micros() - started;
+    unsigned long now = millis();
+
+    task.runCount++;
+    task.lastMicros = took;
+    if (took > task.worstMicros) {
+        task.worstMicros = took;
+    }
+    if (now - dueAt > task.deadlineMillis) { // Finished late...
+        task.overrunCount++;
+    }
+
+    if (moreWork || task.periodMillis == 0UL) { // Run again on the next pass...
+        task.nextRunAt = now;
+
+        return;
+    }
+
+    unsigned long missed = (now - dueAt) / task.periodMillis;
+    task.skipCount += missed;
+    task.nextRunAt = dueAt + (missed + 1UL) * task.periodMillis;
+}
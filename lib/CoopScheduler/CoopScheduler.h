@@ -0,0 +1,90 @@
+#ifndef CoopScheduler_h
+    #define CoopScheduler_h
+
+    #include <Arduino.h>
+
+    #ifndef COOP_SCHEDULER_MAX_TASKS
+        #define COOP_SCHEDULER_MAX_TASKS 10U // Static storage is reserved for this many tasks
+    #endif
+
+    #ifndef COOP_SCHEDULER_SLEEP_MIN_MS
+        #define COOP_SCHEDULER_SLEEP_MIN_MS 2UL // Shorter idle times are spent in yield()
+    #endif
+
+    #ifndef COOP_SCHEDULER_SLEEP_MAX_MS
+        #define COOP_SCHEDULER_SLEEP_MAX_MS 50UL // Longest single idle sleep
+    #endif
+
+    /*
+      CLASS: CoopScheduler
+
+      This class runs the device's work as a set of cooperative tasks in place of a
+      super-loop with a fixed delay. Each task has a period, a priority and a
+      deadline. Every call to run() makes one pass over the tasks in priority order,
+      running each that is due. A task returns true when it still has work in hand,
+      which makes it due again on the next pass rather than a period later.
+
+      When nothing is due until later the time is spent idle, in yield() when the
+      wait is short otherwise in delay(), which lets the SDK put the WiFi modem to
+      sleep, so nothing waits longer than it has to and no cycles are burnt waiting.
+
+      For each task the number of runs, the worst and last run times, overruns
+      (runs that finished more than the task's deadline after it became due) and
+      skipped periods (periods that passed in full before it got to run) are kept.
+
+      Written by: Scott Griffis
+      Date: 10-16-2026
+    */
+    class CoopScheduler {
+        public:
+            enum Priority : uint8_t {
+                CRITICAL = 0, // <-- Such as controlling the outlet
+                ELEVATED, // <------ Such as reading sensors
+                NORMAL, // <-------- Such as serving clients
+                BACKGROUND // <----- Such as indicators and housekeeping
+            };
+
+            typedef bool (*TaskFunction)(void);
+
+        private:
+            struct Task {
+                const char     *name                  ;
+                TaskFunction   function               ;
+                unsigned long  periodMillis           ;
+                unsigned long  deadlineMillis         ;
+                Priority       priority               ;
+                unsigned long  nextRunAt              ;
+                unsigned long  runCount               ;
+                unsigned long  overrunCount           ;
+                unsigned long  skipCount              ;
+                unsigned long  worstMicros            ;
+                unsigned long  lastMicros             ;
+            };
+
+            Task           tasks      [COOP_SCHEDULER_MAX_TASKS] ;
+            uint8_t        taskCount              ;
+            unsigned long  idleMillis             ;
+
+            void runTask(Task &task);
+
+        public:
+            CoopScheduler();
+
+            bool addTask(const char *name, TaskFunction function, unsigned long periodMillis, Priority priority, unsigned long deadlineMillis);
+            void run();
+
+            uint8_t        getTaskCount         ();
+            const char*    getTaskName          (uint8_t index);
+            unsigned long  getTaskPeriodMillis  (uint8_t index);
+            Priority       getTaskPriority      (uint8_t index);
+            unsigned long  getTaskRunCount      (uint8_t index);
+            unsigned long  getTaskOverrunCount  (uint8_t index);
+            unsigned long  getTaskSkipCount     (uint8_t index);
+            unsigned long  getTaskWorstMicros   (uint8_t index);
+            unsigned long  getTaskLastMicros    (uint8_t index);
+            unsigned long  getIdleMillis        ();
+
+            static const char* getPriorityName(Priority priority);
+    };
+
+#endif
@@ -0,0 +1,136 @@
+/*
+  EventStream - Maintains the subscribers of the device's Server-Sent Events
+  stream and delivers events to them.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include "EventStream.h"
+
+/**
+ * #### CLASS CONSTRUCTOR ####
+ * Allows for external instantiation of
+ * the class into an object.
+*/
+EventStream::EventStream() {
+    lastSend = 0UL;
+}
+
+/**
+ * Used to add the given client as a subscriber. The response headers are
+ * written to the client followed by the given event so the subscriber starts
+ * out with the current state.
+ *
+ * @param client The client of the current request as WiFiClientSecure.
+ * @param event The name of the initial event as char pointer.
+ * @param data The data of the initial event as char pointer.
+ *
+ * @return Returns true if the client was subscribed or false if there was
+ * no room for another subscriber, as bool.
+*/
+bool EventStream::subscribe(BearSSL::WiFiClientSecure &client, const char *event, const char *data) {
+    for (unsigned int i = 0U; i < EVENT_STREAM_MAX_SUBSCRIBERS; i++) { // Look for a free slot...
+        if (!subscribers[i].connected()) { // Slot is free...
+            subscribers[i] = client;
+            subscribers[i].setTimeout(EVENT_STREAM_WRITE_TIMEOUT_MS);
+            subscribers[i].print(F(
+                "HTTP/1.1 200 OK\r\n"
+                "Content-Type: text/event-stream\r\n"
+                "Cache-Control: no-cache\r\n"
+                "Connection: keep-alive\r\n"
+                "\r\n"
+            ));
+            publish(event, data);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Used to deliver an event to all subscribers. Any subscriber that can't
+ * take the event right away is dropped.
+ *
+ * @param event The name of the event as char pointer.
+ * @param data The data of the event, which must not contain new-lines, as char pointer.
+*/
+void EventStream::publish(const char *event, const char *data) {
+    char message[192];
+    int length = snprintf_P(message, sizeof(message), PSTR("event: %s\ndata: %s\n\n"), event, data);
+    if (length <= 0 || (size_t) length >= sizeof(message)) { // Event doesn't fit...
+
+        return;
+    }
+
+    for (unsigned int i = 0U; i < EVENT_STREAM_MAX_SUBSCRIBERS; i++) { // Iterate subscribers...
+        send(subscribers[i], message, (size_t) length);
+    }
+    lastSend = millis();
+}
+
+/**
+ * Used to periodically send a comment line to all subscribers when there
+ * have been no events for a while. This keeps intermediaries from closing
+ * the connections and allows for subscribers that have gone away to be found
+ * and dropped. This is intended to be called each time through the loop.
+*/
+void EventStream::keepAlive() {
+    if (millis() - lastSend >= EVENT_STREAM_KEEP_ALIVE_MS) { // Quiet for a while...
+        for (unsigned int i = 0U; i < EVENT_STREAM_MAX_SUBSCRIBERS; i++) { // Iterate subscribers...
+            send(subscribers[i], ":\n\n", 3U);
+        }
+        lastSend = millis();
+    }
+}
+
+/**
+ * Used to get the number of currently connected subscribers.
+ *
+ * @return Returns the subscriber count as unsigned int.
+*/
+unsigned int EventStream::getSubscriberCount() {
+    unsigned int count = 0U;
+    for (unsigned int i = 0U; i < EVENT_STREAM_MAX_SUBSCRIBERS; i++) { // Iterate subscribers...
+        if (subscribers[i].connected()) {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/*
+=================================================================
+Private Functions
+=================================================================
+*/
+
+/**
+ * #### PRIVATE ####
+ * Writes the given data to the given subscriber. If the subscriber is no
+ * longer connected or there isn't room to take all of the data without
+ * waiting then the subscriber is dropped.
+ *
+ * @param client The subscriber to write to as WiFiClientSecure.
+ * @param data The data to write as char pointer.
+ * @param length The length of the data as size_t.
+ *
+ * @return Returns true if the data was written otherwise false as bool.
+*/
+bool EventStream::send(BearSSL::WiFiClientSecure &client, const char *data, size_t length) {
+    if (!client.connected()) { // Nobody is there...
+
+        return false;
+    }
+
+    if (client.availableForWrite() < (int) length || client.write((const uint8_t *) data, length) != length) { // Client is too slow...
+        client.stop();
+
+        return false;
+    }
+
+    return true;
+}
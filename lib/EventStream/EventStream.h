@@ -0,0 +1,47 @@
+#ifndef EventStream_h
+    #define EventStream_h
+
+    #include <WiFiClientSecure.h>
+    #include <WString.h>
+
+    #ifndef EVENT_STREAM_MAX_SUBSCRIBERS
+        #define EVENT_STREAM_MAX_SUBSCRIBERS 2
+    #endif
+
+    #ifndef EVENT_STREAM_KEEP_ALIVE_MS
+        #define EVENT_STREAM_KEEP_ALIVE_MS 15000UL
+    #endif
+
+    #ifndef EVENT_STREAM_WRITE_TIMEOUT_MS
+        #define EVENT_STREAM_WRITE_TIMEOUT_MS 50UL
+    #endif
+
+    /*
+      CLASS: EventStream
+
+      This class maintains the connections of clients that have subscribed to the
+      device's Server-Sent Events stream and delivers events to them. The number of
+      subscribers is capped to protect RAM, as every subscriber holds a TLS
+      connection open. A subscriber that has gone away or can't keep up is dropped
+      rather than allowed to hold up the rest of the device.
+
+      Written by: Scott Griffis
+      Date: 10-16-2026
+    */
+    class EventStream {
+        private:
+            BearSSL::WiFiClientSecure  subscribers   [EVENT_STREAM_MAX_SUBSCRIBERS]  ;
+            unsigned long              lastSend                                      ;
+
+            bool send(BearSSL::WiFiClientSecure &client, const char *data, size_t length);
+
+        public:
+            EventStream();
+
+            bool subscribe(BearSSL::WiFiClientSecure &client, const char *event, const char *data);
+            void publish(const char *event, const char *data);
+            void keepAlive();
+            unsigned int getSubscriberCount();
+    };
+
+#endif
@@ -0,0 +1,388 @@
+/*
+  HostResolver - Turns the host names of sensors into addresses from a cache
+  that is refreshed in the background, using mDNS for .local names.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include "HostResolver.h"
+
+/**
+ * #### CLASS CONSTRUCTOR ####
+ * Allows for external instantiation of
+ * the class into an object.
+*/
+HostResolver::HostResolver() {
+    for (uint8_t i = 0U; i < HOST_RESOLVER_CACHE_SIZE; i++) {
+        entries[i].host[0] = '\0';
+        entries[i].hasAddress = false;
+        entries[i].pending = false;
+        entries[i].lookedUpAt = 0UL;
+        entries[i].usedAt = 0UL;
+    }
+    serviceQuery = nullptr;
+    running = false;
+    lookupCount = 0UL;
+    failedLookupCount = 0UL;
+}
+
+/**
+ * Used to start the mDNS responder under the given host name and the query
+ * for TempBuddy Sensors. Names that aren't .local are resolved whether or not
+ * this has been called.
+ *
+ * @param hostname The host name of this device as String.
+ *
+ * @return Returns true if mDNS was started otherwise false as bool.
+*/
+bool HostResolver::begin(const String &hostname) {
+    if (running) { // Already begun...
+
+        return true;
+    }
+
+    running = MDNS.begin(hostname);
+    if (running) {
+        browse();
+    }
+
+    return running;
+}
+
+/**
+ * Used to keep mDNS going and to refresh cached addresses that are due. This
+ * is intended to be called every time through the loop.
+*/
+void HostResolver::handle() {
+    if (running) {
+        MDNS.update();
+    }
+
+    unsigned long now = millis();
+    for (uint8_t i = 0U; i < HOST_RESOLVER_CACHE_SIZE; i++) {
+        Entry &entry = entries[i];
+        if (entry.host[0] == '\0' || entry.pending) { // Empty or already being looked up...
+
+            continue;
+        }
+
+        unsigned long due = (entry.hasAddress ? HOST_RESOLVER_REFRESH_MS : HOST_RESOLVER_RETRY_MS);
+        if (now - entry.lookedUpAt >= due && now - entry.usedAt < 4UL * HOST_RESOLVER_REFRESH_MS) { // Due and still in use...
+            lookUp(&entry);
+        }
+    }
+}
+
+/**
+ * Used to get the address of the given host. This never waits on a look up;
+ * if the host hasn't been looked up before one is started and false is
+ * returned until it comes in.
+ *
+ * @param host The host name or dot notation IP as String.
+ * @param address Receives the address when known, as IPAddress reference.
+ *
+ * @return Returns true if the address is known otherwise false as bool.
+*/
+bool HostResolver::resolve(const String &host, IPAddress &address) {
+    if (host.isEmpty() || host.length() >= HOST_RESOLVER_HOST_SIZE) { // Nothing that can be resolved...
+
+        return false;
+    }
+
+    IPAddress literal;
+    if (literal.fromString(host)) { // Already an address...
+        address = literal;
+
+        return true;
+    }
+
+    Entry *entry = findEntry(host.c_str());
+    if (entry == nullptr) { // Never looked up...
+        entry = claimEntry(host.c_str());
+        lookUp(entry);
+    }
+    entry->usedAt = millis();
+    if (!entry->hasAddress) { // Still waiting on the first answer...
+
+        return false;
+    }
+    address = entry->address;
+
+    return true;
+}
+
+/**
+ * Used to start the query for TempBuddy Sensors over, dropping any answers
+ * held so that only sensors that are currently on the network are listed.
+*/
+void HostResolver::browse() {
+    if (!running) { // mDNS isn't available...
+
+        return;
+    }
+
+    if (serviceQuery != nullptr) {
+        MDNS.removeServiceQuery(serviceQuery);
+    }
+    // FYI: Answers are read when needed, so nothing is done as they come in...
+    serviceQuery = MDNS.installServiceQuery(
+        HOST_RESOLVER_SERVICE,
+        "tcp",
+        [](const MDNSResponder::MDNSServiceInfo &info, MDNSResponder::AnswerType answerType, bool isSet) {}
+    );
+}
+
+/**
+ * Used to get the number of TempBuddy Sensors found by mDNS.
+ *
+ * @return Returns the count as uint32_t.
+*/
+uint32_t HostResolver::getFoundCount() {
+    if (!running || serviceQuery == nullptr) { // Nothing is being looked for...
+
+        return 0U;
+    }
+
+    return MDNS.answerCount(serviceQuery);
+}
+
+/**
+ * Used to get the host name of a TempBuddy Sensor found by mDNS. Any device
+ * on the LAN can answer the query, so a name that isn't a valid host name is
+ * never given out, as it could carry markup into the pages it is shown on.
+ *
+ * @param index The index of the found sensor as uint32_t.
+ *
+ * @return Returns the host name, such as name.local, or empty if there is
+ * none or it isn't valid, as String.
+*/
+String HostResolver::getFoundHost(uint32_t index) {
+    if (index >= getFoundCount() || !MDNS.hasAnswerHostDomain(serviceQuery, index)) { // Nothing to give...
+
+        return emptyString;
+    }
+
+    String host = String(MDNS.answerHostDomain(serviceQuery, index));
+    if (!isValidHost(host)) { // Not a host name...
+
+        return emptyString;
+    }
+
+    return host;
+}
+
+/**
+ * Used to get the address of a TempBuddy Sensor found by mDNS.
+ *
+ * @param index The index of the found sensor as uint32_t.
+ *
+ * @return Returns the address, unset if not yet known, as IPAddress.
+*/
+IPAddress HostResolver::getFoundAddress(uint32_t index) {
+    if (index >= getFoundCount() || MDNS.answerIP4AddressCount(serviceQuery, index) == 0U) { // Nothing to give...
+
+        return IPAddress();
+    }
+
+    return MDNS.answerIP4Address(serviceQuery, index, 0U);
+}
+
+/**
+ * Used to get the number of look ups that have been started.
+ *
+ * @return Returns the count as unsigned long.
+*/
+unsigned long HostResolver::getLookupCount() {
+
+    return lookupCount;
+}
+
+/**
+ * Used to get the number of look ups that found no address.
+ *
+ * @return Returns the count as unsigned long.
+*/
+unsigned long HostResolver::getFailedLookupCount() {
+
+    return failedLookupCount;
+}
+
+/**
+ * Used to tell if the given string can be used as the host of a sensor, being
+ * either a host name made of letters, digits and hyphens between the dots
+ * or a dot notation IP.
+ *
+ * @param host The string to check as String.
+ *
+ * @return Returns true if valid otherwise false as bool.
+*/
+bool HostResolver::isValidHost(const String &host) {
+    if (host.isEmpty() || host.length() >= HOST_RESOLVER_HOST_SIZE) {
+
+        return false;
+    }
+
+    unsigned int labelLength = 0U;
+    char last = '.';
+    for (unsigned int i = 0U; i < host.length(); i++) {
+        char c = host.charAt(i);
+        if (c == '.') {
+            if (labelLength == 0U || last == '-') { // Empty label or one ending in a hyphen...
+
+                return false;
+            }
+            labelLength = 0U;
+        } else if (isalnum(c) || (c == '-' && labelLength > 0U)) {
+            if (++labelLength > 63U) { // Label too long...
+
+                return false;
+            }
+        } else { // Not allowed in a host name...
+
+            return false;
+        }
+        last = c;
+    }
+
+    return labelLength > 0U && last != '-';
+}
+
+/*
+=================================================================
+Private Functions
+=================================================================
+*/
+
+/**
+ * #### PRIVATE ####
+ * Finds the cache entry of the given host.
+ *
+ * @param host The host name as char pointer.
+ *
+ * @return Returns the entry, or nullptr if not cached, as Entry pointer.
+*/
+HostResolver::Entry* HostResolver::findEntry(const char *host) {
+    for (uint8_t i = 0U; i < HOST_RESOLVER_CACHE_SIZE; i++) {
+        if (entries[i].host[0] != '\0' && strcasecmp(entries[i].host, host) == 0) {
+
+            return &entries[i];
+        }
+    }
+
+    return nullptr;
+}
+
+/**
+ * #### PRIVATE ####
+ * Gives the given host a cache entry, taking an empty one if there is one
+ * otherwise the one used least recently.
+ *
+ * @param host The host name as char pointer.
+ *
+ * @return Returns the entry as Entry pointer.
+*/
+HostResolver::Entry* HostResolver::claimEntry(const char *host) {
+    Entry *entry = &entries[0];
+    for (uint8_t i = 0U; i < HOST_RESOLVER_CACHE_SIZE; i++) {
+        if (entries[i].host[0] == '\0') { // Empty...
+            entry = &entries[i];
+
+            break;
+        }
+        if (millis() - entries[i].usedAt > millis() - entry->usedAt) { // Used less recently...
+            entry = &entries[i];
+        }
+    }
+
+    // FYI: An answer still on its way for the old host won't match the new name...
+    strcpy(entry->host, host);
+    entry->hasAddress = false;
+    entry->pending = false;
+    entry->usedAt = millis();
+
+    return entry;
+}
+
+/**
+ * #### PRIVATE ####
+ * Looks the entry's host up, from the mDNS answers if it can be found there
+ * otherwise with dns_gethostbyname(). The cached address is only replaced if
+ * an address is found.
+ *
+ * @param entry The entry to look up as Entry pointer.
+*/
+void HostResolver::lookUp(Entry *entry) {
+    entry->lookedUpAt = millis();
+    lookupCount++;
+    if (lookUpMdns(entry)) { // Found by mDNS...
+
+        return;
+    }
+
+    ip_addr_t found;
+    err_t result = dns_gethostbyname(entry->host, &found, &HostResolver::dnsFound, this);
+    if (result == ERR_OK) { // Answered from lwIP's cache...
+        entry->address = IPAddress(&found);
+        entry->hasAddress = true;
+    } else if (result == ERR_INPROGRESS) { // dnsFound() will be called with the answer...
+        entry->pending = true;
+    } else {
+        failedLookupCount++;
+    }
+}
+
+/**
+ * #### PRIVATE ####
+ * Looks the entry's host up among the answers to the mDNS query. Only .local
+ * names are looked for.
+ *
+ * @param entry The entry to look up as Entry pointer.
+ *
+ * @return Returns true if found otherwise false as bool.
+*/
+bool HostResolver::lookUpMdns(Entry *entry) {
+    size_t length = strlen(entry->host);
+    if (length < 6U || strcasecmp(entry->host + length - 6U, ".local") != 0) { // Not an mDNS name...
+
+        return false;
+    }
+
+    uint32_t count = getFoundCount();
+    for (uint32_t i = 0U; i < count; i++) {
+        if (
+          MDNS.hasAnswerHostDomain(serviceQuery, i)
+          && strcasecmp(MDNS.answerHostDomain(serviceQuery, i), entry->host) == 0
+          && MDNS.answerIP4AddressCount(serviceQuery, i) > 0U
+        ) {
+            entry->address = MDNS.answerIP4Address(serviceQuery, i, 0U);
+            entry->hasAddress = true;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * #### PRIVATE ####
+ * Called by lwIP with the answer to a look up started by lookUp().
+*/
+void HostResolver::dnsFound(const char *name, const ip_addr_t *ipaddr, void *arg) {
+    HostResolver *resolver = (HostResolver *) arg;
+    Entry *entry = resolver->findEntry(name);
+    if (entry == nullptr || !entry->pending) { // Entry was given to another host...
+
+        return;
+    }
+
+    entry->pending = false;
+    if (ipaddr == nullptr) { // Not found...
+        resolver->failedLookupCount++;
+
+        return;
+    }
+    entry->address = IPAddress(ipaddr);
+    entry->hasAddress = true;
+}
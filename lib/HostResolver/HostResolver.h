@@ -0,0 +1,92 @@
+#ifndef HostResolver_h
+    #define HostResolver_h
+
+    #include <ESP8266mDNS.h>
+    #include <IPAddress.h>
+    #include <WString.h>
+    #include <lwip/dns.h>
+
+    #ifndef HOST_RESOLVER_CACHE_SIZE
+        #define HOST_RESOLVER_CACHE_SIZE 4U // Number of host names whose addresses are kept
+    #endif
+
+    #ifndef HOST_RESOLVER_HOST_SIZE
+        #define HOST_RESOLVER_HOST_SIZE 64U // Longest host name kept + 1
+    #endif
+
+    #ifndef HOST_RESOLVER_REFRESH_MS
+        #define HOST_RESOLVER_REFRESH_MS 60000UL // How often a cached address is looked up again
+    #endif
+
+    #ifndef HOST_RESOLVER_RETRY_MS
+        #define HOST_RESOLVER_RETRY_MS 5000UL // How soon a failed look up is tried again
+    #endif
+
+    #ifndef HOST_RESOLVER_SERVICE
+        #define HOST_RESOLVER_SERVICE "tempbuddy" // mDNS service, as _tempbuddy._tcp, the sensors advertise
+    #endif
+
+    /*
+      CLASS: HostResolver
+
+      This class turns the host names of sensors into addresses without ever making
+      the caller wait. resolve() answers straight from a small cache and, when the
+      cached address is due to be refreshed or there is none yet, starts a look up
+      in the background; the old address keeps being used until the new one comes
+      in, so a sensor whose name stops resolving is still tried where it last was.
+
+      Names ending in .local are first looked for among the answers to an mDNS
+      query for the HOST_RESOLVER_SERVICE service that is kept running from
+      begin(). mDNS drops those answers itself once their TTL runs out. Any other
+      name, or a .local name not found that way, is looked up with lwIP's
+      dns_gethostbyname(), whose own cache honors the TTL of the records it gets;
+      asking it again every HOST_RESOLVER_REFRESH_MS means a changed record is
+      picked up soon after that TTL runs out. Dot notation IPs are used as is.
+
+      The answers to the mDNS query are also what getFoundCount() and friends list,
+      so that sensors on the network can be offered for selection.
+
+      Written by: Scott Griffis
+      Date: 10-16-2026
+    */
+    class HostResolver {
+        private:
+            struct Entry {
+                char           host             [HOST_RESOLVER_HOST_SIZE] ;
+                IPAddress      address                                    ;
+                bool           hasAddress                                 ;
+                bool           pending                                    ; // A dns_gethostbyname() answer is awaited
+                unsigned long  lookedUpAt                                 ;
+                unsigned long  usedAt                                     ;
+            };
+
+            Entry                             entries   [HOST_RESOLVER_CACHE_SIZE] ;
+            MDNSResponder::hMDNSServiceQuery  serviceQuery                         ;
+            bool                              running                              ;
+            unsigned long                     lookupCount                          ;
+            unsigned long                     failedLookupCount                    ;
+
+            Entry* findEntry(const char *host);
+            Entry* claimEntry(const char *host);
+            void lookUp(Entry *entry);
+            bool lookUpMdns(Entry *entry);
+            static void dnsFound(const char *name, const ip_addr_t *ipaddr, void *arg);
+
+        public:
+            HostResolver();
+
+            bool begin(const String &hostname);
+            void handle();
+            bool resolve(const String &host, IPAddress &address);
+            void browse();
+
+            uint32_t       getFoundCount        ();
+            String         getFoundHost         (uint32_t index);
+            IPAddress      getFoundAddress      (uint32_t index);
+            unsigned long  getLookupCount       ();
+            unsigned long  getFailedLookupCount ();
+
+            static bool isValidHost(const String &host);
+    };
+
+#endif
@@ -0,0 +1,151 @@
+/*
+  JsonArena - An ArduinoJson allocator that serves documents from memory
+  reserved at build time.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include "JsonArena.h"
+
+// Everything handed out is aligned for the largest value ArduinoJson stores...
+#define JSON_ARENA_ALIGN(size) (((size) + 7U) & ~((size_t) 7U))
+
+/**
+ * #### CLASS CONSTRUCTOR ####
+ * Allows for external instantiation of
+ * the class into an object.
+*/
+JsonArena::JsonArena() {
+    used = 0U;
+    last = 0U;
+    live = 0U;
+    overflowCount = 0UL;
+}
+
+/**
+ * Called by ArduinoJson to get a block of memory.
+ *
+ * @param size The number of bytes needed as size_t.
+ *
+ * @return Returns the block or nullptr if there is no memory as void pointer.
+*/
+void* JsonArena::allocate(size_t size) {
+    size_t aligned = JSON_ARENA_ALIGN(size);
+    if (aligned <= JSON_ARENA_SIZE - used) { // Fits in the arena...
+        last = used;
+        used += aligned;
+        live++;
+
+        return storage + last;
+    }
+    overflowCount++;
+
+    return malloc(size);
+}
+
+/**
+ * Called by ArduinoJson to give back a block of memory. Once every block
+ * of the arena has been given back the whole arena is free again.
+ *
+ * @param ptr The block to give back as void pointer.
+*/
+void JsonArena::deallocate(void *ptr) {
+    if (ptr == nullptr) { // Nothing to give back...
+
+        return;
+    }
+
+    if (!owns(ptr)) { // Came from the heap...
+        free(ptr);
+
+        return;
+    }
+
+    live--;
+    if (live == 0U) { // Arena is empty...
+        used = 0U;
+        last = 0U;
+    }
+}
+
+/**
+ * Called by ArduinoJson to grow or shrink a block of memory. The most
+ * recently handed out block is resized where it is, others are moved.
+ *
+ * @param ptr The block to resize as void pointer.
+ * @param newSize The number of bytes needed as size_t.
+ *
+ * @return Returns the resized block or nullptr if there is no memory as void pointer.
+*/
+void* JsonArena::reallocate(void *ptr, size_t newSize) {
+    if (ptr == nullptr) { // Nothing to resize...
+
+        return allocate(newSize);
+    }
+
+    if (!owns(ptr)) { // Came from the heap...
+
+        return realloc(ptr, newSize);
+    }
+
+    size_t offset = (uint8_t*) ptr - storage;
+    if (offset == last && JSON_ARENA_ALIGN(newSize) <= JSON_ARENA_SIZE - last) { // Resize in place...
+        used = last + JSON_ARENA_ALIGN(newSize);
+
+        return ptr;
+    }
+
+    // FYI: Block sizes aren't tracked, but no block runs past what was in use...
+    size_t oldSize = used - offset;
+    void *moved = allocate(newSize);
+    if (moved == nullptr) { // No memory...
+
+        return nullptr;
+    }
+    memcpy(moved, ptr, (oldSize < newSize ? oldSize : newSize));
+    deallocate(ptr);
+
+    return moved;
+}
+
+/**
+ * Used to get the number of bytes of the arena in use.
+ *
+ * @return Returns the number of bytes as size_t.
+*/
+size_t JsonArena::getUsed() {
+
+    return used;
+}
+
+/**
+ * Used to get the number of times the arena ran short and the heap was
+ * used instead. If this isn't zero then JSON_ARENA_SIZE should be raised.
+ *
+ * @return Returns the count as unsigned long.
+*/
+unsigned long JsonArena::getOverflowCount() {
+
+    return overflowCount;
+}
+
+/*
+=================================================================
+Private Functions
+=================================================================
+*/
+
+/**
+ * #### PRIVATE ####
+ * Used to tell if the given block came from the arena.
+ *
+ * @param ptr The block to check as void pointer.
+ *
+ * @return Returns true if it came from the arena otherwise false as bool.
+*/
+bool JsonArena::owns(void *ptr) {
+    uint8_t *block = (uint8_t*) ptr;
+
+    return block >= storage && block < storage + JSON_ARENA_SIZE;
+}
@@ -0,0 +1,50 @@
+#ifndef JsonArena_h
+    #define JsonArena_h
+
+    #include <ArduinoJson.h>
+    #include <stdint.h>
+    #include <stdlib.h>
+    #include <string.h>
+
+    #ifndef JSON_ARENA_SIZE
+        #define JSON_ARENA_SIZE 2048U // Bytes reserved for the documents using the arena
+    #endif
+
+    /*
+      CLASS: JsonArena
+
+      This class is an ArduinoJson allocator that hands out memory from a buffer
+      reserved at build time instead of the heap. Memory is handed out in order
+      and all of it is reclaimed at once when everything that was handed out has
+      been given back, which ArduinoJson does each time a document is cleared or
+      parsed into again. So a document that is reused for the same sort of data
+      over and over, such as the sensor's responses, never touches the heap.
+
+      Should the arena ever run short the heap is used for what doesn't fit,
+      rather than failing the parse.
+
+      Written by: Scott Griffis
+      Date: 10-16-2026
+    */
+    class JsonArena : public ArduinoJson::Allocator {
+        private:
+            alignas(8) uint8_t   storage   [JSON_ARENA_SIZE]  ;
+            size_t               used                         ;
+            size_t               last                         ;
+            size_t               live                         ;
+            unsigned long        overflowCount                ;
+
+            bool owns(void *ptr);
+
+        public:
+            JsonArena();
+
+            void* allocate(size_t size) override;
+            void deallocate(void *ptr) override;
+            void* reallocate(void *ptr, size_t newSize) override;
+
+            size_t         getUsed            ();
+            unsigned long  getOverflowCount   ();
+    };
+
+#endif
@@ -4,11 +4,47 @@
 
   Written by: Scott Griffis
   Date: 10-01-2023
-  Version: 3.0.0
+  Version: 3.1.0
 */
 
 #include "ParseUtils.h"
 
+#include <limits.h>
+#include <string.h>
+
+#define PARSE_UTILS_NOT_HEX 0xFF
+
+// Value of each character as a hex digit, PARSE_UTILS_NOT_HEX if it isn't one...
+static const uint8_t HEX_VALUES[256] = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+// Powers of ten that a float holds exactly...
+static const float FLOAT_POW10[] = {
+  1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+// Powers of ten that a double holds exactly...
+static const double DOUBLE_POW10[] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
 /**
  * Allows for information to be parsed out of a String between a Keyword and a Terminating
  * String. If the Terminator doesn't exist then this function will parse to the end of the line.
@@ -28,25 +64,9 @@
  * @return Returns the parsed data as String
  */
 String ParseUtils::parseByKeyword(String &str, String keyword, String terminator) {
-    int keyIndex = str.indexOf(keyword);
-    if (keyIndex == -1) { // Keyword wasn't found...
-        
-        return "";
-    }
-    int endIndex = str.indexOf(terminator, keyIndex + keyword.length());
-
-    // Look for Terminator if not found parse to end of line...
-    if (endIndex == -1) { // Terminator not found...
-        endIndex = str.indexOf("\n", keyIndex);
-    }
+    std::string_view result = parseByKeyword(toView(str), toView(keyword), toView(terminator));
 
-    // If line terminator not found then to end of string...
-    if (endIndex == -1) { // New-line not found...
-
-        return str.substring(keyIndex + keyword.length());
-    } 
-
-    return str.substring(keyIndex + keyword.length(), endIndex);
+    return toString(result);
 }
 
 /**
@@ -68,25 +88,43 @@ String ParseUtils::parseByKeyword(String &str, String keyword, String terminator
  * @return Returns the parsed data as std::string
  */
 std::string ParseUtils::parseByKeyword(std::string &str, std::string keyword, std::string terminator) {
-    int keyIndex = str.find(keyword);
-    if (keyIndex == -1) { // Keyword wasn't found...
+    std::string_view result = parseByKeyword(std::string_view(str), keyword, terminator);
+
+    return std::string(result);
+}
+
+/**
+ * Allows for information to be parsed out of a string between a Keyword and a Terminating
+ * string, the same as the other parseByKeyword() overloads, but without copying anything.
+ * What is returned views the given string.
+ * 
+ * @param str - The string from which to parse data as std::string_view.
+ * @param keyword - The keyword to start parsing data just after as std::string_view.
+ * @param terminator - The terminator to parse up until as std::string_view.
+ * 
+ * @return Returns the parsed data as std::string_view
+ */
+std::string_view ParseUtils::parseByKeyword(std::string_view str, std::string_view keyword, std::string_view terminator) {
+    size_t keyIndex = str.find(keyword);
+    if (keyIndex == std::string_view::npos) { // Keyword wasn't found...
         
-        return "";
+        return std::string_view();
     }
-    int endIndex = str.find(terminator, keyIndex + keyword.length());
+    size_t beginIndex = keyIndex + keyword.length();
+    size_t endIndex = str.find(terminator, beginIndex);
 
     // Look for Terminator if not found parse to end of line...
-    if (endIndex == -1) { // Terminator not found...
-        endIndex = str.find("\n", keyIndex);
+    if (endIndex == std::string_view::npos) { // Terminator not found...
+        endIndex = str.find('\n', keyIndex);
     }
 
     // If line terminator not found then to end of string...
-    if (endIndex == -1) { // New-line not found...
+    if (endIndex == std::string_view::npos) { // New-line not found...
 
-        return substring(str, keyIndex + keyword.length());
+        return substring(str, beginIndex);
     } 
 
-    return substring(str, keyIndex + keyword.length(), endIndex);
+    return substring(str, beginIndex, endIndex);
 }
 
 /**
@@ -200,20 +238,10 @@ unsigned int ParseUtils::occurrences(std::string &str, std::string toCnt) {
  * @param sizeOfStorage - The size of the storage array provided.
  */
 void ParseUtils::split(String &str, char separator, String *storage, unsigned int sizeOfStorage) {
-  unsigned int index = 0;
-  for (unsigned int segmentIndex = 0U; segmentIndex < sizeOfStorage && index < str.length(); segmentIndex++) { // iterate segment storage...
-    unsigned int startIndex = index;
-    for (;index < str.length(); index++) { // increment index though length of the string...
-      if (str.charAt(index) == separator) { // Found a separator...
-        storage[segmentIndex] = str.substring(startIndex, index);
-        index++;
-
-        break; // to allow segmentIndex to increment
-      } else if (index == (str.length() - 1)) { // at the end of the string...
-        index++;
-        storage[segmentIndex] = str.substring(startIndex, index);
-      }
-    }
+  SplitIterator parts(toView(str), separator);
+  std::string_view part;
+  for (unsigned int segmentIndex = 0U; segmentIndex < sizeOfStorage && parts.next(part); segmentIndex++) { // iterate segment storage...
+    storage[segmentIndex] = toString(part);
   }
 }
 
@@ -229,23 +257,33 @@ void ParseUtils::split(String &str, char separator, String *storage, unsigned in
  * @param sizeOfStorage - The size of the storage array provided as int.
  */
 void ParseUtils::split(std::string &str, char separator, std::string *storage, unsigned int sizeOfStorage) {
-  unsigned int index = 0U;
-  for (unsigned int segmentIndex = 0U; segmentIndex < sizeOfStorage && index < str.length(); segmentIndex++) { // iterate segment storage...
-    unsigned int startIndex = index;
-    for (;index < str.length(); index++) { // increment index though length of the string...
-      if (str.at(index) == separator) { // Found a separator...
-        storage[segmentIndex] = substring(str, startIndex, index);
-        index++;
-
-        break; // to allow segmentIndex to increment
-      } else if (index == (str.length() - 1)) { // at the end of the string...
-        index++;
-        storage[segmentIndex] = substring(str, startIndex, index);
-      }
-    }
+  SplitIterator parts(str, separator);
+  std::string_view part;
+  for (unsigned int segmentIndex = 0U; segmentIndex < sizeOfStorage && parts.next(part); segmentIndex++) { // iterate segment storage...
+    storage[segmentIndex] = std::string(part);
   }
 }
 
+/**
+ * Splits the given string up into multiple segments based on the given separator, without
+ * copying anything or needing storage for the segments. The segments are had one at a time
+ * from the returned iterator as views into the given string, which must outlive them.
+ *
+ * Example:
+ * ParseUtils::SplitIterator parts = ParseUtils::split(str, ',');
+ * std::string_view part;
+ * while (parts.next(part)) { ... }
+ *
+ * @param str - The string to perform the operation on as std::string_view.
+ * @param separator - The character to use as a separator for the splitting process as char.
+ *
+ * @return Returns an iterator over the segments as SplitIterator.
+ */
+ParseUtils::SplitIterator ParseUtils::split(std::string_view str, char separator) {
+
+  return SplitIterator(str, separator);
+}
+
 /**
  * Performs a substring type function on the given string where what is returned
  * is determined by parsing the data out inclusively from the beginIndex and 
@@ -260,7 +298,7 @@ void ParseUtils::split(std::string &str, char separator, std::string *storage, u
  */
 std::string ParseUtils::substring(std::string &str, unsigned int beginIndex, unsigned int endIndex) {
 
-  return str.substr(beginIndex, endIndex - beginIndex);
+  return std::string(substring(std::string_view(str), (size_t) beginIndex, (size_t) endIndex));
 }
 
 /**
@@ -276,7 +314,43 @@ std::string ParseUtils::substring(std::string &str, unsigned int beginIndex, uns
  */
 std::string ParseUtils::substring(std::string &str, unsigned int beginIndex) {
 
-  return str.substr(beginIndex);
+  return std::string(substring(std::string_view(str), (size_t) beginIndex));
+}
+
+/**
+ * Performs a substring type function on the given string without copying anything, the
+ * same as the other substring() overloads. What is returned views the given string. An
+ * index past the end of the string is taken as the end of the string.
+ *
+ * @param str - The string to parse from as std::string_view.
+ * @param beginIndex - The index to inclusively begin parsing from as size_t.
+ * @param endIndex - The index to exclusively parse up to as size_t.
+ *
+ * @return Returns the parsed string as std::string_view.
+ */
+std::string_view ParseUtils::substring(std::string_view str, size_t beginIndex, size_t endIndex) {
+  if (beginIndex > str.length()) {
+    beginIndex = str.length();
+  }
+  if (endIndex < beginIndex) {
+    endIndex = beginIndex;
+  }
+
+  return str.substr(beginIndex, endIndex - beginIndex);
+}
+
+/**
+ * Performs a substring type function on the given string, from the beginIndex to the end
+ * of the string, without copying anything. What is returned views the given string.
+ *
+ * @param str - The string to parse from as std::string_view.
+ * @param beginIndex - The index to inclusively begin parsing from as size_t.
+ * 
+ * @return Returns the parsed string as std::string_view.
+ */
+std::string_view ParseUtils::substring(std::string_view str, size_t beginIndex) {
+
+  return substring(str, beginIndex, str.length());
 }
 
 /**
@@ -288,18 +362,30 @@ std::string ParseUtils::substring(std::string &str, unsigned int beginIndex) {
  * @return Returns the resulting string as std::string.
  */
 std::string ParseUtils::trim(std::string &str) {
-  std::string result = str;
+
+  return std::string(trim(std::string_view(str)));
+}
+
+/**
+ * Trims whitespace from both ends of the given string without copying
+ * anything. What is returned views the given string.
+ *
+ * @param str - The string to trim as std::string_view.
+ * 
+ * @return Returns the resulting string as std::string_view.
+ */
+std::string_view ParseUtils::trim(std::string_view str) {
   // Trim from the front of the string...
-  while(!result.empty() && result.at(0) <= 32) {
-    result.erase(0, 1);
+  while(!str.empty() && (unsigned char) str.front() <= 32) {
+    str.remove_prefix(1);
   }
 
   // Trim from the end of the string...
-  while(!result.empty() && result.at(result.length() - 1) <= 32) {
-    result.erase(result.length() - 1, 1);
+  while(!str.empty() && (unsigned char) str.back() <= 32) {
+    str.remove_suffix(1);
   }
 
-  return result;
+  return str;
 }
 
 /**
@@ -312,30 +398,13 @@ std::string ParseUtils::trim(std::string &str) {
  * @return Returns the parsed value as float.
  */
 float ParseUtils::toFloat(std::string str) {
-  if (!str.empty()) { // Something to work on...
-    for (unsigned int i = 0; i < str.length(); i++) { // Verify that chars are valid for a number...
-      if (!((str.at(i) >= '0' && str.at(i) <= '9') || str.at(i) == '.' || str.at(i) == '-')) { // not even close to valid number...
-        
-        return 0;
-      }
-    }
-
-    int minus = occurrences(str, '-');
-    if (minus > 1 || (minus == 1 && str.at(0) != '-')) { // too many minus signs or in wrong spot...
+  float value = 0.0;
+  if (parseFloat(str.c_str(), str.length(), value) != NUMBER_OK) { // Not a valid number...
 
-      return 0;
-    }
-
-    int period = occurrences(str, '.');
-    if (period > 1) { // Not a valid number...
-
-      return 0;
-    }
-
-    return std::stof(str);
+    return 0;
   }
 
-  return 0;
+  return value;
 }
 
 /**
@@ -348,75 +417,38 @@ float ParseUtils::toFloat(std::string str) {
  * @return Returns the parsed value as double.
  */
 double ParseUtils::toDouble(std::string str) {
-  if (!str.empty()) { // Something to work on...
-    for (unsigned int i = 0; i < str.length(); i++) { // Verify that chars are valid for a number...
-      if (!((str.at(i) >= '0' && str.at(i) <= '9') || str.at(i) == '.' || str.at(i) == '-')) { // not even close to valid number...
-        
-        return 0;
-      }
-    }
-
-    int minus = occurrences(str, '-');
-    if (minus > 1 || (minus == 1 && str.at(0) != '-')) { // too many minus signs or in wrong spot...
-
-      return 0;
-    }
+  double value = 0.0;
+  if (parseDouble(str.c_str(), str.length(), value) != NUMBER_OK) { // Not a valid number...
 
-    int period = occurrences(str, '.');
-    if (period > 1) { // Not a valid number...
-
-      return 0;
-    }
-
-    return std::stod(str);
+    return 0;
   }
 
-  return 0;
+  return value;
 }
 
 /**
  * Used to parse an int out from a string that contains a valid integer 
  * number. If the contents of the given string are not a valid integer 
- * then the integer value of zero will be returned.
+ * then the integer value of zero will be returned. A number with a
+ * fraction loses the fraction.
  *
  * @param str - The string to be parsed as an integer as std::string.
  * 
  * @return Returns the parsed value as int.
  */
 int ParseUtils::toInt(std::string str) {
-  if (!str.empty()) { // Something to work on...
-    for (unsigned int i = 0; i < str.length(); i++) { // Verify that chars are valid for a number...
-      if (!((str.at(i) >= '0' && str.at(i) <= '9') || str.at(i) == '.' || str.at(i) == '-')) { // not even close to valid number...
-        
-        return 0;
-      }
-    }
-
-    int minus = occurrences(str, '-');
-    if (minus > 1 || (minus == 1 && str.at(0) != '-')) { // too many minus signs or in wrong spot...
-
-      return 0;
-    }
-
-    int period = occurrences(str, '.');
-    if (period > 1) { // Not a valid number...
-
-      return 0;
-    }
-
-    if (period == 1) { // Number is a float type...
-      // lose percision...
-      std::string temp = substring(str, 0, str.find('.'));
-      if (temp.empty()) {
-
-        return 0;
-      }
-
-      return std::stoi(temp);
-    }
+  double value = 0.0;
+  if (
+    parseDouble(str.c_str(), str.length(), value) != NUMBER_OK
+    || value > INT_MAX
+    || value < INT_MIN
+  ) { // Not a valid number or won't fit...
+
+    return 0;
   }
 
-  return std::stoi(str);
+  // lose percision...
+  return (int) value;
 }
 
 /**
@@ -438,7 +470,7 @@ unsigned int ParseUtils::hexStringToInt(String hex) {
   for (unsigned int i = 0; i < hex.length(); i++) {
     char c = hex.charAt(i);
     unsigned int temp = c - '0';
-    if (temp >= 0 && temp <= 9) { // is a number digit...
+    if (temp <= 9) { // is a number digit...
       result += (temp * pow(16,(hex.length() - i - 1)));
     } else { // Could be a letter digit...
       temp = c - 'A' + 10;
@@ -478,7 +510,7 @@ unsigned int ParseUtils::hexStringToInt(std::string hex) {
   for (unsigned int i = 0; i < hex.length(); i++) {
     char c = hex.at(i);
     unsigned int temp = c - '0';
-    if (temp >= 0 && temp <= 9) { // is a number digit...
+    if (temp <= 9) { // is a number digit...
       result += (temp * pow(16,(hex.length() - i - 1)));
     } else { // Could be a letter digit...
       temp = c - 'A' + 10;
@@ -622,7 +654,7 @@ std::string ParseUtils::arrangeDigitsUsingPattern(std::string inputString, std::
         if (found) {
           std::string content = maskedContent[fetchIndex];
 
-          result += substring(content, content.length() - count, content.length());
+          result += substring(content, (unsigned int) (content.length() - count), (unsigned int) content.length());
         } else { 
           found += c; // Pattern char must not be mask but literal
         }
@@ -684,93 +716,81 @@ unsigned int ParseUtils::countConsecutiveRepeatingChars(std::string &str, unsign
 }
 
 /**
- * Decodes a URL encoded string.
+ * Decodes a URL encoded string in place, a plus being taken as a space as in
+ * form encoding. See decodeUrl().
  *
  * @param str The string to decode as String. 
+ *
+ * @return Returns the decoded string as String.
  */
 String ParseUtils::decodeUrlString(String &str) {
-  str.replace("%20", " ");
-  str.replace("%21", "!");
-  str.replace("%23", "#");
-  str.replace("%24", "$");
-  str.replace("%26", "&");
-  str.replace("%27", "'");
-  str.replace("%28", "(");
-  str.replace("%29", ")");
-  str.replace("%2A", "*");
-  str.replace("+", " ");
-  str.replace("%2B", "+");
-  str.replace("%2C", ",");
-  str.replace("%2F", "/");
-  str.replace("%3A", ":");
-  str.replace("%3B", ";");
-  str.replace("%3D", "=");
-  str.replace("%3F", "?");
-  str.replace("%40", "@");
-  str.replace("%5B", "[");
-  str.replace("%2D", "]");
-  str.replace("%22", "\"");
-  str.replace("%25", "%");
-  str.replace("%2D", "-");
-  str.replace("%2E", ".");
-  str.replace("%3C", "<");
-  str.replace("%3E", ">");
-  str.replace("%5C", "\\");
-  str.replace("%5E", "^");
-  str.replace("%5F", "_");
-  str.replace("%60", "`");
-  str.replace("%7B", "{");
-  str.replace("%7C", "|");
-  str.replace("%7D", "}");
-  str.replace("%7E", "~");
+  size_t length = decodeUrl(str.c_str(), str.length(), str.begin(), str.length() + 1U);
+  str.remove(length);
 
   return str;
 }
 
 /**
- * Decodes a URL encoded string.
+ * Decodes a URL encoded string in place, a plus being taken as a space as in
+ * form encoding. See decodeUrl().
  *
  * @param str - The string to decode as std::string. 
+ *
+ * @return Returns the decoded string as std::string.
  */
 std::string ParseUtils::decodeUrlString(std::string &str) {
-  replace(str, "%20", " ");
-  replace(str, "%21", "!");
-  replace(str, "%23", "#");
-  replace(str, "%24", "$");
-  replace(str, "%26", "&");
-  replace(str, "%27", "'");
-  replace(str, "%28", "(");
-  replace(str, "%29", ")");
-  replace(str, "%2A", "*");
-  replace(str, "+", " ");
-  replace(str, "%2B", "+");
-  replace(str, "%2C", ",");
-  replace(str, "%2F", "/");
-  replace(str, "%3A", ":");
-  replace(str, "%3B", ";");
-  replace(str, "%3D", "=");
-  replace(str, "%3F", "?");
-  replace(str, "%40", "@");
-  replace(str, "%5B", "[");
-  replace(str, "%2D", "]");
-  replace(str, "%22", "\"");
-  replace(str, "%25", "%");
-  replace(str, "%2D", "-");
-  replace(str, "%2E", ".");
-  replace(str, "%3C", "<");
-  replace(str, "%3E", ">");
-  replace(str, "%5C", "\\");
-  replace(str, "%5E", "^");
-  replace(str, "%5F", "_");
-  replace(str, "%60", "`");
-  replace(str, "%7B", "{");
-  replace(str, "%7C", "|");
-  replace(str, "%7D", "}");
-  replace(str, "%7E", "~");
+  size_t length = decodeUrl(str.c_str(), str.length(), &str[0], str.length() + 1U);
+  str.resize(length);
 
   return str;
 }
 
+/**
+ * Decodes URL encoded text in a single pass into the given buffer without
+ * allocating. Any %XX escape is decoded, in either case, and a % that isn't
+ * followed by two hex digits is kept as it is. The buffer may be the text
+ * itself to decode in place, as decoding never makes the text longer. The
+ * result is always null terminated.
+ *
+ * @param text - The text to decode as char pointer.
+ * @param length - The length of the text as size_t.
+ * @param buffer - The buffer to write into, length + 1 being enough, as char pointer.
+ * @param size - The size of the buffer as size_t.
+ * @param plusIsSpace - True to take a plus as a space, as form encoding does, otherwise false as bool.
+ *
+ * @return Returns the decoded length, zero if it didn't fit, as size_t.
+ */
+size_t ParseUtils::decodeUrl(const char *text, size_t length, char *buffer, size_t size, bool plusIsSpace) {
+  if (buffer == NULL || size == 0U) { // Nowhere to write...
+
+    return 0U;
+  }
+
+  size_t written = 0U;
+  for (size_t at = 0U; at < length; at++) {
+    if (written + 1U >= size) { // Doesn't fit...
+      buffer[0] = '\0';
+
+      return 0U;
+    }
+    char c = text[at];
+    if (c == '%' && at + 2U < length) {
+      uint8_t high = HEX_VALUES[(uint8_t) text[at + 1U]];
+      uint8_t low = HEX_VALUES[(uint8_t) text[at + 2U]];
+      if (high != PARSE_UTILS_NOT_HEX && low != PARSE_UTILS_NOT_HEX) { // A proper escape...
+        c = (char) ((high << 4) | low);
+        at += 2U;
+      }
+    } else if (c == '+' && plusIsSpace) {
+      c = ' ';
+    }
+    buffer[written++] = c;
+  }
+  buffer[written] = '\0';
+
+  return written;
+}
+
 /**
  * Used to replace a specified string of characters from within a given string, with another
  * string of characters. This supports the replaceWith string being larger than the string 
@@ -811,10 +831,14 @@ bool ParseUtils::validDotNotationIp(String &str) {
     return false;
   }
 
-  String octets[4] = {""};
-  split(str, '.', octets, sizeof(octets));
+  SplitIterator octets(toView(str), '.');
+  std::string_view octet;
   for (int i = 0; i < 4; i++) { // Iterate and verify octet values...
-    int oct = octets[i].toInt();
+    long oct = 0L;
+    if (!octets.next(octet) || parseLong(octet.data(), octet.length(), oct) != NUMBER_OK) { // Octet isn't a number...
+
+      return false;
+    }
     switch (i) {
       case 0:
         if (oct < 1 || oct > 223) {
@@ -832,4 +856,596 @@ bool ParseUtils::validDotNotationIp(String &str) {
   }
 
   return true;
-}
\ No newline at end of file
+}
+
+/**
+ * Used to view the contents of the given String without copying it. The view
+ * is only good until the String is changed or goes away.
+ *
+ * @param str - The String to view as String.
+ *
+ * @return Returns the view as std::string_view.
+ */
+std::string_view ParseUtils::toView(const String &str) {
+
+  return std::string_view(str.c_str(), str.length());
+}
+
+/**
+ * Used to copy the given view into a new String, for where a String must be
+ * had.
+ *
+ * @param view - The view to copy as std::string_view.
+ *
+ * @return Returns the copy as String.
+ */
+String ParseUtils::toString(std::string_view view) {
+  String result;
+  result.concat(view.data(), view.length());
+
+  return result;
+}
+
+/**
+ * Used to parse a whole number out of the given text without allocating,
+ * throwing or looking at the locale. The whole text must be the number, an
+ * optional sign followed by digits, with no whitespace.
+ *
+ * @param text - The text to parse as char pointer.
+ * @param length - The length of the text as size_t.
+ * @param value - Receives the number, only when NUMBER_OK, as long reference.
+ *
+ * @return Returns how the parse went as NumberStatus.
+ */
+ParseUtils::NumberStatus ParseUtils::parseLong(const char *text, size_t length, long &value) {
+  if (text == NULL || length == 0U) { // Nothing to parse...
+
+    return NUMBER_EMPTY;
+  }
+
+  size_t at = 0U;
+  bool negative = false;
+  if (text[at] == '-' || text[at] == '+') {
+    negative = (text[at] == '-');
+    at++;
+  }
+  if (at == length) { // Sign only...
+
+    return NUMBER_INVALID;
+  }
+
+  unsigned long limit = (negative ? (unsigned long) LONG_MAX + 1UL : (unsigned long) LONG_MAX);
+  unsigned long magnitude = 0UL;
+  bool overflow = false;
+  for (; at < length; at++) {
+    if (text[at] < '0' || text[at] > '9') { // Not a digit...
+
+      return NUMBER_INVALID;
+    }
+    unsigned long digit = (unsigned long) (text[at] - '0');
+    if (overflow || magnitude > (limit - digit) / 10UL) { // Keep checking the rest are digits...
+      overflow = true;
+    } else {
+      magnitude = magnitude * 10UL + digit;
+    }
+  }
+  if (overflow) {
+
+    return NUMBER_OUT_OF_RANGE;
+  }
+  value = (negative ? (long) (0UL - magnitude) : (long) magnitude);
+
+  return NUMBER_OK;
+}
+
+/**
+ * Used to parse a whole number out of the given null terminated text.
+ * See parseLong(const char*, size_t, long&).
+ *
+ * @param text - The text to parse as char pointer.
+ * @param value - Receives the number, only when NUMBER_OK, as long reference.
+ *
+ * @return Returns how the parse went as NumberStatus.
+ */
+ParseUtils::NumberStatus ParseUtils::parseLong(const char *text, long &value) {
+
+  return parseLong(text, (text == NULL ? 0U : strlen(text)), value);
+}
+
+/**
+ * Used to parse a decimal number out of the given text as a fixed point whole
+ * number with the given number of decimal places, so "71.6" with 2 decimals is
+ * 7160. Digits past the decimal places are rounded off, half away from zero.
+ * This is done entirely in integers, without allocating, throwing or looking
+ * at the locale. The whole text must be the number, an optional sign, digits
+ * and an optional point and fraction, with no whitespace or exponent.
+ *
+ * @param text - The text to parse as char pointer.
+ * @param length - The length of the text as size_t.
+ * @param decimals - The decimal places to keep, up to PARSE_UTILS_MAX_DECIMALS, as uint8_t.
+ * @param value - Receives the fixed point number, only when NUMBER_OK, as long reference.
+ *
+ * @return Returns how the parse went as NumberStatus.
+ */
+ParseUtils::NumberStatus ParseUtils::parseFixed(const char *text, size_t length, uint8_t decimals, long &value) {
+  if (text == NULL || length == 0U) { // Nothing to parse...
+
+    return NUMBER_EMPTY;
+  }
+  if (decimals > PARSE_UTILS_MAX_DECIMALS) {
+    decimals = PARSE_UTILS_MAX_DECIMALS;
+  }
+
+  size_t at = 0U;
+  bool negative = false;
+  if (text[at] == '-' || text[at] == '+') {
+    negative = (text[at] == '-');
+    at++;
+  }
+
+  unsigned long limit = (negative ? (unsigned long) LONG_MAX + 1UL : (unsigned long) LONG_MAX);
+  unsigned long magnitude = 0UL;
+  bool overflow = false;
+  bool pastPoint = false;
+  bool roundUp = false;
+  uint8_t fractionDigits = 0U;
+  size_t digits = 0U;
+  for (; at < length; at++) {
+    char c = text[at];
+    if (c == '.' && !pastPoint) {
+      pastPoint = true;
+
+      continue;
+    }
+    if (c < '0' || c > '9') { // Not a digit...
+
+      return NUMBER_INVALID;
+    }
+    digits++;
+    if (pastPoint && fractionDigits >= decimals) { // Past the decimal places, only the first rounds...
+      if (fractionDigits == decimals) {
+        roundUp = (c >= '5');
+        fractionDigits++;
+      }
+
+      continue;
+    }
+    if (pastPoint) {
+      fractionDigits++;
+    }
+    unsigned long digit = (unsigned long) (c - '0');
+    if (overflow || magnitude > (limit - digit) / 10UL) {
+      overflow = true;
+    } else {
+      magnitude = magnitude * 10UL + digit;
+    }
+  }
+  if (digits == 0U) { // No digits at all...
+
+    return NUMBER_INVALID;
+  }
+
+  // Fill out any decimal places the text left off...
+  for (; fractionDigits < decimals; fractionDigits++) {
+    if (overflow || magnitude > limit / 10UL) {
+      overflow = true;
+    } else {
+      magnitude *= 10UL;
+    }
+  }
+  if (roundUp) {
+    if (overflow || magnitude >= limit) {
+      overflow = true;
+    } else {
+      magnitude++;
+    }
+  }
+  if (overflow) {
+
+    return NUMBER_OUT_OF_RANGE;
+  }
+  value = (negative ? (long) (0UL - magnitude) : (long) magnitude);
+
+  return NUMBER_OK;
+}
+
+/**
+ * Used to parse a decimal number out of the given null terminated text as a
+ * fixed point whole number. See parseFixed(const char*, size_t, uint8_t, long&).
+ *
+ * @param text - The text to parse as char pointer.
+ * @param decimals - The decimal places to keep, up to PARSE_UTILS_MAX_DECIMALS, as uint8_t.
+ * @param value - Receives the fixed point number, only when NUMBER_OK, as long reference.
+ *
+ * @return Returns how the parse went as NumberStatus.
+ */
+ParseUtils::NumberStatus ParseUtils::parseFixed(const char *text, uint8_t decimals, long &value) {
+
+  return parseFixed(text, (text == NULL ? 0U : strlen(text)), decimals, value);
+}
+
+/**
+ * Used to parse a floating point number out of the given text without
+ * allocating, throwing or looking at the locale. The whole text must be the
+ * number, an optional sign, digits, an optional point and fraction and an
+ * optional exponent such as e-3, with no whitespace. Numbers with up to 7
+ * significant digits and small exponents, which covers anything typed into a
+ * form, are worked out with a single float multiply or divide.
+ *
+ * @param text - The text to parse as char pointer.
+ * @param length - The length of the text as size_t.
+ * @param value - Receives the number, only when NUMBER_OK, as float reference.
+ *
+ * @return Returns how the parse went as NumberStatus.
+ */
+ParseUtils::NumberStatus ParseUtils::parseFloat(const char *text, size_t length, float &value) {
+  bool negative = false;
+  uint32_t mantissa = 0U;
+  int32_t exponent = 0;
+  NumberStatus status = scanDecimal(text, length, negative, mantissa, exponent);
+  if (status != NUMBER_OK) {
+
+    return status;
+  }
+
+  float result = 0.0;
+  if (mantissa < (1UL << 24) && exponent >= -10 && exponent <= 10) { // Exact in a float, one rounding...
+    result = (float) mantissa;
+    result = (exponent >= 0 ? result * FLOAT_POW10[exponent] : result / FLOAT_POW10[-exponent]);
+  } else {
+    // FYI: Range is checked after rounding to a float, as text just above FLT_MAX, such as
+    // 3.4028235e38, still rounds to it...
+    result = (float) scaleDecimal(mantissa, exponent);
+    if (isinf(result)) { // Too big for a float...
+
+      return NUMBER_OUT_OF_RANGE;
+    }
+  }
+  value = (negative ? -result : result);
+
+  return NUMBER_OK;
+}
+
+/**
+ * Used to parse a floating point number out of the given null terminated text.
+ * See parseFloat(const char*, size_t, float&).
+ *
+ * @param text - The text to parse as char pointer.
+ * @param value - Receives the number, only when NUMBER_OK, as float reference.
+ *
+ * @return Returns how the parse went as NumberStatus.
+ */
+ParseUtils::NumberStatus ParseUtils::parseFloat(const char *text, float &value) {
+
+  return parseFloat(text, (text == NULL ? 0U : strlen(text)), value);
+}
+
+/**
+ * Used to parse a double out of the given text. Takes the same text as
+ * parseFloat() but keeps up to 9 significant digits.
+ *
+ * @param text - The text to parse as char pointer.
+ * @param length - The length of the text as size_t.
+ * @param value - Receives the number, only when NUMBER_OK, as double reference.
+ *
+ * @return Returns how the parse went as NumberStatus.
+ */
+ParseUtils::NumberStatus ParseUtils::parseDouble(const char *text, size_t length, double &value) {
+  bool negative = false;
+  uint32_t mantissa = 0U;
+  int32_t exponent = 0;
+  NumberStatus status = scanDecimal(text, length, negative, mantissa, exponent);
+  if (status != NUMBER_OK) {
+
+    return status;
+  }
+
+  double result = scaleDecimal(mantissa, exponent);
+  if (isinf(result)) { // Too big for a double...
+
+    return NUMBER_OUT_OF_RANGE;
+  }
+  value = (negative ? -result : result);
+
+  return NUMBER_OK;
+}
+
+/**
+ * Used to parse a double out of the given null terminated text.
+ * See parseDouble(const char*, size_t, double&).
+ *
+ * @param text - The text to parse as char pointer.
+ * @param value - Receives the number, only when NUMBER_OK, as double reference.
+ *
+ * @return Returns how the parse went as NumberStatus.
+ */
+ParseUtils::NumberStatus ParseUtils::parseDouble(const char *text, double &value) {
+
+  return parseDouble(text, (text == NULL ? 0U : strlen(text)), value);
+}
+
+/**
+ * Used to format a whole number into the given buffer without allocating.
+ *
+ * @param value - The number to format as long.
+ * @param buffer - The buffer to write into, PARSE_UTILS_NUMBER_TEXT_SIZE being enough, as char pointer.
+ * @param size - The size of the buffer as size_t.
+ *
+ * @return Returns the length written, zero if it didn't fit, as size_t.
+ */
+size_t ParseUtils::formatLong(long value, char *buffer, size_t size) {
+
+  return formatFixed(value, 0U, false, buffer, size);
+}
+
+/**
+ * Used to format a fixed point whole number as a decimal with the given
+ * number of decimal places, so 7160 with 2 decimals is "71.60", or "71.6"
+ * when trimming zeros. This is done entirely in integers without allocating.
+ *
+ * @param value - The fixed point number to format as long.
+ * @param decimals - The decimal places in the number, up to PARSE_UTILS_MAX_DECIMALS, as uint8_t.
+ * @param trimZeros - True to leave off trailing zeros in the fraction otherwise false as bool.
+ * @param buffer - The buffer to write into, PARSE_UTILS_NUMBER_TEXT_SIZE being enough, as char pointer.
+ * @param size - The size of the buffer as size_t.
+ *
+ * @return Returns the length written, zero if it didn't fit, as size_t.
+ */
+size_t ParseUtils::formatFixed(long value, uint8_t decimals, bool trimZeros, char *buffer, size_t size) {
+  if (decimals > PARSE_UTILS_MAX_DECIMALS) {
+    decimals = PARSE_UTILS_MAX_DECIMALS;
+  }
+
+  // Written backward from the end of the text...
+  char text[PARSE_UTILS_NUMBER_TEXT_SIZE];
+  size_t at = sizeof(text);
+  unsigned long magnitude = (value < 0L ? 0UL - (unsigned long) value : (unsigned long) value);
+  bool trimming = trimZeros;
+  for (uint8_t place = 0U; place < decimals; place++) {
+    char digit = (char) ('0' + magnitude % 10UL);
+    magnitude /= 10UL;
+    if (trimming && digit == '0') { // Trailing zero...
+
+      continue;
+    }
+    trimming = false;
+    text[--at] = digit;
+  }
+  if (at < sizeof(text)) { // There is a fraction...
+    text[--at] = '.';
+  }
+  do {
+    text[--at] = (char) ('0' + magnitude % 10UL);
+    magnitude /= 10UL;
+  } while (magnitude > 0UL);
+  if (value < 0L) {
+    text[--at] = '-';
+  }
+
+  size_t length = sizeof(text) - at;
+  if (buffer == NULL || length + 1U > size) { // Doesn't fit...
+    if (buffer != NULL && size > 0U) {
+      buffer[0] = '\0';
+    }
+
+    return 0U;
+  }
+  memcpy(buffer, text + at, length);
+  buffer[length] = '\0';
+
+  return length;
+}
+
+/**
+ * Used to format a floating point number as a decimal with the given number
+ * of decimal places, rounded half away from zero, without allocating. The
+ * number is scaled to a fixed point whole number with one float multiply and
+ * the rest is integer work, unlike Print and String which loop in floats.
+ *
+ * @param value - The number to format as float.
+ * @param decimals - The decimal places to write, up to PARSE_UTILS_MAX_DECIMALS, as uint8_t.
+ * @param trimZeros - True to leave off trailing zeros in the fraction otherwise false as bool.
+ * @param buffer - The buffer to write into, PARSE_UTILS_NUMBER_TEXT_SIZE being enough, as char pointer.
+ * @param size - The size of the buffer as size_t.
+ *
+ * @return Returns the length written, zero if it didn't fit or isn't a number, as size_t.
+ */
+size_t ParseUtils::formatFloat(float value, uint8_t decimals, bool trimZeros, char *buffer, size_t size) {
+  if (decimals > PARSE_UTILS_MAX_DECIMALS) {
+    decimals = PARSE_UTILS_MAX_DECIMALS;
+  }
+
+  float scaled = value * FLOAT_POW10[decimals];
+  if (isnan(scaled) || scaled >= (float) LONG_MAX || scaled <= (float) LONG_MIN) { // Can't be written...
+    if (buffer != NULL && size > 0U) {
+      buffer[0] = '\0';
+    }
+
+    return 0U;
+  }
+  long fixed = (long) (scaled < 0.0f ? scaled - 0.5f : scaled + 0.5f);
+
+  return formatFixed(fixed, decimals, trimZeros, buffer, size);
+}
+
+/**
+ * #### CLASS CONSTRUCTOR ####
+ * Allows for external instantiation of
+ * the class into an object.
+ *
+ * @param str - The string to split as std::string_view.
+ * @param separator - The character that separates the parts as char.
+ */
+ParseUtils::SplitIterator::SplitIterator(std::string_view str, char separator) {
+  this->str = str;
+  this->separator = separator;
+  at = 0U;
+}
+
+/**
+ * Used to get the next part of the string.
+ *
+ * @param part - Receives the part, viewing the string, as std::string_view reference.
+ *
+ * @return Returns true if there was another part otherwise false as bool.
+ */
+bool ParseUtils::SplitIterator::next(std::string_view &part) {
+  if (at >= str.length()) { // No more parts...
+
+    return false;
+  }
+
+  size_t end = str.find(separator, at);
+  if (end == std::string_view::npos) { // Last part...
+    end = str.length();
+  }
+  part = str.substr(at, end - at);
+  at = end + 1U;
+
+  return true;
+}
+
+/*
+=================================================================
+Private Functions
+=================================================================
+*/
+
+/**
+ * #### PRIVATE ####
+ * Scans the given text as a decimal number, an optional sign, digits, an
+ * optional point and fraction and an optional exponent, into a mantissa of up
+ * to 9 significant digits and a power of ten. Digits past those are rounded
+ * off.
+ *
+ * @param text - The text to scan as char pointer.
+ * @param length - The length of the text as size_t.
+ * @param negative - Receives true if the number is negative as bool reference.
+ * @param mantissa - Receives the significant digits as uint32_t reference.
+ * @param exponent - Receives the power of ten to scale the mantissa by as int32_t reference.
+ *
+ * @return Returns how the scan went as NumberStatus.
+ */
+ParseUtils::NumberStatus ParseUtils::scanDecimal(const char *text, size_t length, bool &negative, uint32_t &mantissa, int32_t &exponent) {
+  negative = false;
+  mantissa = 0U;
+  exponent = 0;
+  if (text == NULL || length == 0U) { // Nothing to scan...
+
+    return NUMBER_EMPTY;
+  }
+
+  size_t at = 0U;
+  if (text[at] == '-' || text[at] == '+') {
+    negative = (text[at] == '-');
+    at++;
+  }
+
+  uint8_t kept = 0U;
+  bool pastPoint = false;
+  bool roundChecked = false;
+  size_t digits = 0U;
+  for (; at < length; at++) {
+    char c = text[at];
+    if (c == '.' && !pastPoint) {
+      pastPoint = true;
+
+      continue;
+    }
+    if (c < '0' || c > '9') { // End of the digits...
+
+      break;
+    }
+    digits++;
+    if (kept < 9U) { // Still room in the mantissa...
+      mantissa = mantissa * 10U + (uint32_t) (c - '0');
+      if (mantissa != 0U) { // Leading zeros aren't significant...
+        kept++;
+      }
+      if (pastPoint && exponent > -100000) {
+        exponent--;
+      }
+    } else {
+      if (!roundChecked) { // The first digit dropped rounds...
+        roundChecked = true;
+        if (c >= '5') {
+          mantissa++;
+        }
+      }
+      if (!pastPoint && exponent < 100000) {
+        exponent++;
+      }
+    }
+  }
+  if (digits == 0U) { // No digits at all...
+
+    return NUMBER_INVALID;
+  }
+
+  if (at < length && (text[at] == 'e' || text[at] == 'E')) { // Exponent...
+    at++;
+    bool negativeExponent = false;
+    if (at < length && (text[at] == '-' || text[at] == '+')) {
+      negativeExponent = (text[at] == '-');
+      at++;
+    }
+    int32_t power = 0;
+    size_t powerDigits = 0U;
+    for (; at < length && text[at] >= '0' && text[at] <= '9'; at++) {
+      if (power < 100000) {
+        power = power * 10 + (text[at] - '0');
+      }
+      powerDigits++;
+    }
+    if (powerDigits == 0U) { // An e without a power...
+
+      return NUMBER_INVALID;
+    }
+    exponent += (negativeExponent ? -power : power);
+  }
+  if (at != length) { // Something other than the number...
+
+    return NUMBER_INVALID;
+  }
+
+  return NUMBER_OK;
+}
+
+/**
+ * #### PRIVATE ####
+ * Scales the given mantissa by the given power of ten using exact powers of
+ * ten, so numbers with small exponents are only rounded once.
+ *
+ * @param mantissa - The significant digits as uint32_t.
+ * @param exponent - The power of ten to scale by as int32_t.
+ *
+ * @return Returns the scaled number, infinity if too big, as double.
+ */
+double ParseUtils::scaleDecimal(uint32_t mantissa, int32_t exponent) {
+  double result = (double) mantissa;
+  if (mantissa == 0U || exponent == 0) { // Nothing to scale...
+
+    return result;
+  }
+  if (exponent > 320) { // Too big for a double...
+
+    return HUGE_VAL;
+  }
+  if (exponent < -350) { // Too small for a double...
+
+    return 0.0;
+  }
+
+  while (exponent > 0) {
+    int32_t step = (exponent > 22 ? 22 : exponent);
+    result *= DOUBLE_POW10[step];
+    exponent -= step;
+  }
+  while (exponent < 0) {
+    int32_t step = (exponent < -22 ? 22 : -exponent);
+    result /= DOUBLE_POW10[step];
+    exponent += step;
+  }
+
+  return result;
+}
@@ -4,7 +4,7 @@
 
   Written by: Scott Griffis
   Date: 10-01-2023
-  Version: 3.0.0
+  Version: 3.1.0
 */
 
 #ifndef ParseUtils_h
@@ -12,12 +12,53 @@
 
 #include <WString.h>
 #include <string>
+#include <string_view>
 #include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define PARSE_UTILS_NUMBER_TEXT_SIZE 24U // Longest formatted number, sign, 10 digits, point, 9 decimals + 1 null
+#define PARSE_UTILS_MAX_DECIMALS 9U // Most decimal places parseFixed() and the formatters handle
 
 class ParseUtils {
+    public:
+        /*
+          CLASS: ParseUtils::SplitIterator
+
+          This class walks the parts of a string between a separator, handing
+          each part back as a view into the string rather than a copy. Parts
+          that are empty between two separators are given, but nothing is given
+          after a trailing separator or for an empty string. The string viewed
+          must outlive the iterator and the parts it gives.
+
+          Written by: Scott Griffis
+          Date: 10-16-2026
+        */
+        class SplitIterator {
+            private:
+                std::string_view  str                ;
+                char              separator          ;
+                size_t            at                 ;
+
+            public:
+                SplitIterator(std::string_view str, char separator);
+
+                bool next(std::string_view &part);
+        };
+
+        enum NumberStatus : uint8_t {
+            NUMBER_OK = 0,
+            NUMBER_EMPTY,
+            NUMBER_INVALID,
+            NUMBER_OUT_OF_RANGE
+        };
+
     private:
         ParseUtils();
 
+        static NumberStatus scanDecimal(const char *text, size_t length, bool &negative, uint32_t &mantissa, int32_t &exponent);
+        static double scaleDecimal(uint32_t mantissa, int32_t exponent);
+
     public:
         static String arrangeDigitsUsingPattern(String inputString, String inputPattern, String desiredPattern);
         static std::string arrangeDigitsUsingPattern(std::string inputString, std::string inputPattern, std::string desiredPattern);
@@ -27,6 +68,7 @@ class ParseUtils {
 
         static String decodeUrlString(String &str);
         static std::string decodeUrlString(std::string &str);
+        static size_t decodeUrl(const char *text, size_t length, char *buffer, size_t size, bool plusIsSpace = true);
         
         static unsigned int hexStringToInt(String hex);
         static unsigned int hexStringToInt(std::string hex);
@@ -38,20 +80,41 @@ class ParseUtils {
 
         static String parseByKeyword(String &str, String keyword, String terminator);
         static std::string parseByKeyword(std::string &str, std::string keyword, std::string terminator);
+        static std::string_view parseByKeyword(std::string_view str, std::string_view keyword, std::string_view terminator);
 
         static std::string replace(std::string &str, std::string find, std::string replaceWith);
 
         static void split(String &str, char separator, String *storage, unsigned int sizeOfStorage);
         static void split(std::string &str, char separator, std::string *storage, unsigned int sizeOfStorage);
+        static SplitIterator split(std::string_view str, char separator);
         static std::string substring(std::string &str, unsigned int beginIndex, unsigned int endIndex);
         static std::string substring(std::string &str, unsigned int beginIndex);
+        static std::string_view substring(std::string_view str, size_t beginIndex, size_t endIndex);
+        static std::string_view substring(std::string_view str, size_t beginIndex);
 
         static int toInt(std::string str);
         static float toFloat(std::string str);
         static double toDouble(std::string str);
         static std::string trim(std::string &str);
+        static std::string_view trim(std::string_view str);
         static String trunc(String &str, unsigned int length);
         
         static bool validDotNotationIp(String &str);
+
+        static std::string_view toView(const String &str);
+        static String toString(std::string_view view);
+
+        static NumberStatus parseLong(const char *text, size_t length, long &value);
+        static NumberStatus parseLong(const char *text, long &value);
+        static NumberStatus parseFixed(const char *text, size_t length, uint8_t decimals, long &value);
+        static NumberStatus parseFixed(const char *text, uint8_t decimals, long &value);
+        static NumberStatus parseFloat(const char *text, size_t length, float &value);
+        static NumberStatus parseFloat(const char *text, float &value);
+        static NumberStatus parseDouble(const char *text, size_t length, double &value);
+        static NumberStatus parseDouble(const char *text, double &value);
+
+        static size_t formatLong(long value, char *buffer, size_t size);
+        static size_t formatFixed(long value, uint8_t decimals, bool trimZeros, char *buffer, size_t size);
+        static size_t formatFloat(float value, uint8_t decimals, bool trimZeros, char *buffer, size_t size);
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,168 @@
+/*
+  PidController - Works out a PID output for the outlet and turns it into on
+  and off times within a time-proportioning window.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include "PidController.h"
+
+/**
+ * #### CLASS CONSTRUCTOR ####
+ * Allows for external instantiation of
+ * the class into an object.
+*/
+PidController::PidController() {
+    kp = 0.0;
+    ki = 0.0;
+    kd = 0.0;
+    windowMillis = 600000UL;
+    reset();
+}
+
+/**
+ * Used to set the gains, see the class comment for their units.
+ *
+ * @param kp The proportional gain as float.
+ * @param ki The integral gain as float.
+ * @param kd The derivative gain as float.
+*/
+void PidController::setGains(float kp, float ki, float kd) {
+    this->kp = kp;
+    this->ki = ki;
+    this->kd = kd;
+}
+
+/**
+ * Used to set the length of the time-proportioning window. The new length is
+ * used from the next window on.
+ *
+ * @param windowMillis The length of the window in milliseconds as unsigned long.
+*/
+void PidController::setWindow(unsigned long windowMillis) {
+    this->windowMillis = windowMillis;
+}
+
+/**
+ * Used to update the output with the latest temperature and to tell if the
+ * outlet should be on right now. This is intended to be called often; the
+ * output is only worked out every PID_CONTROLLER_SAMPLE_MS and the on time is
+ * only taken from it at the start of each window.
+ *
+ * @param desiredTemp The desired temperature as float.
+ * @param temp The current temperature as float.
+ * @param isHeat True if the outlet heats, false if it cools, as bool.
+ * @param now The current time in milliseconds as unsigned long.
+ *
+ * @return Returns true if the outlet should be on otherwise false as bool.
+*/
+bool PidController::update(float desiredTemp, float temp, bool isHeat, unsigned long now) {
+    if (!hasSample || now - lastSampleAt >= PID_CONTROLLER_SAMPLE_MS) { // Time to work out the output...
+        sample(desiredTemp, temp, isHeat, now);
+    }
+
+    if (!hasWindow || now - windowStart >= windowMillis) { // A new window starts...
+        hasWindow = true;
+        windowStart = now;
+        onMillis = (unsigned long) (output * (float) windowMillis);
+    }
+
+    return now - windowStart < onMillis;
+}
+
+/**
+ * Used to forget the integral, the last temperature and the current window,
+ * such as when PID control is taken up again after another mode.
+*/
+void PidController::reset() {
+    integral = 0.0;
+    output = 0.0;
+    lastTemp = 0.0;
+    lastSampleAt = 0UL;
+    hasSample = false;
+    windowStart = 0UL;
+    onMillis = 0UL;
+    hasWindow = false;
+}
+
+/**
+ * Used to get the latest output.
+ *
+ * @return Returns the fraction of the window the outlet is on for as float.
+*/
+float PidController::getOutput() {
+
+    return output;
+}
+
+/**
+ * Used to get the integral part of the output.
+ *
+ * @return Returns the integral as float.
+*/
+float PidController::getIntegral() {
+
+    return integral;
+}
+
+/**
+ * Used to get the length of the time-proportioning window.
+ *
+ * @return Returns the length in milliseconds as unsigned long.
+*/
+unsigned long PidController::getWindowMillis() {
+
+    return windowMillis;
+}
+
+/*
+=================================================================
+Private Functions
+=================================================================
+*/
+
+/**
+ * #### PRIVATE ####
+ * Works out the output from the given temperature.
+ *
+ * @param desiredTemp The desired temperature as float.
+ * @param temp The current temperature as float.
+ * @param isHeat True if the outlet heats, false if it cools, as bool.
+ * @param now The current time in milliseconds as unsigned long.
+*/
+void PidController::sample(float desiredTemp, float temp, bool isHeat, unsigned long now) {
+    // FYI: Cooling works the other way around, being needed when it is too warm...
+    float error = (isHeat ? desiredTemp - temp : temp - desiredTemp);
+    float dTerm = 0.0;
+    float minutes = 0.0;
+    if (hasSample) {
+        minutes = (float) (now - lastSampleAt) / 60000.0;
+        float rate = (minutes > 0.0 ? (temp - lastTemp) / minutes : 0.0);
+        dTerm = -kd * (isHeat ? rate : -rate);
+    }
+    float pTerm = kp * error;
+
+    // Only integrate when it doesn't push the output further past its limits...
+    float candidate = integral + ki * error * minutes;
+    float unclamped = pTerm + candidate + dTerm;
+    if (!((unclamped > 1.0 && error > 0.0) || (unclamped < 0.0 && error < 0.0))) {
+        integral = candidate;
+    }
+    if (integral > 1.0) {
+        integral = 1.0;
+    } else if (integral < 0.0) {
+        integral = 0.0;
+    }
+
+    output = pTerm + integral + dTerm;
+    if (output > 1.0) {
+        output = 1.0;
+    } else if (output < 0.0) {
+        output = 0.0;
+    }
+
+    lastTemp = temp;
+    lastSampleAt = now;
+    hasSample = true;
+}
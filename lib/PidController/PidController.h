@@ -0,0 +1,62 @@
+#ifndef PidController_h
+    #define PidController_h
+
+    #include <stdint.h>
+
+    #ifndef PID_CONTROLLER_SAMPLE_MS
+        #define PID_CONTROLLER_SAMPLE_MS 5000UL // How often the output is worked out
+    #endif
+
+    /*
+      CLASS: PidController
+
+      This class works out how much of the time the outlet should be on to hold the
+      temperature at the desired temperature, as a PID output between 0 and 1. The
+      output drives a time-proportioning window: at the start of each window the
+      outlet is on for that fraction of the window and then off for the rest, so
+      the relay switches at most twice a window however the temperature moves.
+
+      Gains are in terms of degrees F and minutes: kp is output per degree of error,
+      ki is output per degree-minute of error and kd is output per degree-per-minute
+      the temperature is moving. The derivative is taken of the temperature rather
+      than the error so that changing the desired temperature doesn't kick the
+      output. To keep the integral from winding up while the output is pinned at 0
+      or 1, such as while a cold room heats up, it is only added to when doing so
+      doesn't push the output further past its limits, and is kept within them.
+
+      Nothing here depends on the device so it can be built and run on a host.
+
+      Written by: Scott Griffis
+      Date: 10-16-2026
+    */
+    class PidController {
+        private:
+            float          kp                     ;
+            float          ki                     ;
+            float          kd                     ;
+            unsigned long  windowMillis           ;
+            float          integral               ;
+            float          output                 ;
+            float          lastTemp               ;
+            unsigned long  lastSampleAt           ;
+            bool           hasSample              ;
+            unsigned long  windowStart            ;
+            unsigned long  onMillis               ;
+            bool           hasWindow              ;
+
+            void sample(float desiredTemp, float temp, bool isHeat, unsigned long now);
+
+        public:
+            PidController();
+
+            void setGains(float kp, float ki, float kd);
+            void setWindow(unsigned long windowMillis);
+            bool update(float desiredTemp, float temp, bool isHeat, unsigned long now);
+            void reset();
+
+            float          getOutput              ();
+            float          getIntegral            ();
+            unsigned long  getWindowMillis        ();
+    };
+
+#endif
@@ -0,0 +1,107 @@
+/*
+  PollInterval - Works out how long to wait between reads of the TempBuddy
+  Sensors from how the temperature is behaving.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include "PollInterval.h"
+
+/**
+ * #### CLASS CONSTRUCTOR ####
+ * Allows for external instantiation of
+ * the class into an object.
+*/
+PollInterval::PollInterval() {
+    floorMillis = 15000UL;
+    ceilingMillis = 300000UL;
+    interval = floorMillis;
+    lastUpdate = 0UL;
+    lastTempF = 0.0;
+    ratePerMin = 0.0;
+    hasLast = false;
+}
+
+/**
+ * Used to set the shortest and longest interval that may be used. The
+ * current interval is brought within the new bounds right away.
+ *
+ * @param floorMillis The shortest interval in milliseconds as unsigned long.
+ * @param ceilingMillis The longest interval in milliseconds as unsigned long.
+*/
+void PollInterval::setBounds(unsigned long floorMillis, unsigned long ceilingMillis) {
+    if (ceilingMillis < floorMillis) { // Bounds are backwards...
+        ceilingMillis = floorMillis;
+    }
+    this->floorMillis = floorMillis;
+    this->ceilingMillis = ceilingMillis;
+
+    if (interval < floorMillis) {
+        interval = floorMillis;
+    } else if (interval > ceilingMillis) {
+        interval = ceilingMillis;
+    }
+}
+
+/**
+ * Used to give a new temperature so that the interval can be worked out
+ * again.
+ *
+ * @param tempF The new temperature in Fahrenheit as float.
+ * @param lowThresholdF The lower temperature the outlet switches at as float.
+ * @param highThresholdF The higher temperature the outlet switches at as float.
+ * @param now The current millis() as unsigned long.
+*/
+void PollInterval::update(float tempF, float lowThresholdF, float highThresholdF, unsigned long now) {
+    if (hasLast && now != lastUpdate) { // Can work out a rate...
+        float rate = (tempF - lastTempF) * 60000.0 / (float) (now - lastUpdate);
+        ratePerMin = POLL_INTERVAL_RATE_SMOOTHING * rate + (1.0 - POLL_INTERVAL_RATE_SMOOTHING) * ratePerMin;
+    }
+    lastTempF = tempF;
+    lastUpdate = now;
+    hasLast = true;
+
+    float distance = fminf(fabsf(tempF - lowThresholdF), fabsf(tempF - highThresholdF));
+
+    // Shrink as the temperature nears a threshold...
+    float wanted = (float) ceilingMillis;
+    if (distance < POLL_INTERVAL_NEAR_BAND_F) {
+        wanted = wanted * distance / POLL_INTERVAL_NEAR_BAND_F;
+    }
+
+    // Read at least twice before a threshold could be reached...
+    float speed = fabsf(ratePerMin);
+    if (speed > 0.001) { // Temperature is moving...
+        float eta = distance / speed * 60000.0;
+        wanted = fminf(wanted, eta / 2.0);
+    }
+
+    if (wanted <= (float) floorMillis) {
+        interval = floorMillis;
+    } else if (wanted >= (float) ceilingMillis) {
+        interval = ceilingMillis;
+    } else {
+        interval = (unsigned long) wanted;
+    }
+}
+
+/**
+ * Used to get how long to wait between reads.
+ *
+ * @return Returns the interval in milliseconds as unsigned long.
+*/
+unsigned long PollInterval::getInterval() {
+
+    return interval;
+}
+
+/**
+ * Used to get the smoothed rate the temperature is changing at.
+ *
+ * @return Returns the rate in degrees Fahrenheit per minute as float.
+*/
+float PollInterval::getRatePerMin() {
+
+    return ratePerMin;
+}
@@ -0,0 +1,50 @@
+#ifndef PollInterval_h
+    #define PollInterval_h
+
+    #include <math.h>
+
+    #ifndef POLL_INTERVAL_NEAR_BAND_F
+        #define POLL_INTERVAL_NEAR_BAND_F 2.0 // Within this of a threshold the interval starts to shrink
+    #endif
+
+    #ifndef POLL_INTERVAL_RATE_SMOOTHING
+        #define POLL_INTERVAL_RATE_SMOOTHING 0.5 // Weight given to the newest rate of change
+    #endif
+
+    /*
+      CLASS: PollInterval
+
+      This class works out how long to wait between reads of the TempBuddy Sensors.
+      It is given each new temperature along with the two thresholds the outlet is
+      switched at, and from those it keeps a smoothed rate of change. The interval
+      is then chosen so that the sensors are read at least twice before the
+      temperature could reach the nearest threshold at its current rate, and it
+      is also shrunk in proportion as the temperature gets within
+      POLL_INTERVAL_NEAR_BAND_F of a threshold. The result is always kept between
+      the floor and ceiling it is given, so a stable room is read rarely and one
+      that is about to switch the outlet is read often.
+
+      Written by: Scott Griffis
+      Date: 10-16-2026
+    */
+    class PollInterval {
+        private:
+            unsigned long  floorMillis            ;
+            unsigned long  ceilingMillis          ;
+            unsigned long  interval               ;
+            unsigned long  lastUpdate             ;
+            float          lastTempF              ;
+            float          ratePerMin             ; // Smoothed rate of change in degrees F per minute
+            bool           hasLast                ;
+
+        public:
+            PollInterval();
+
+            void setBounds(unsigned long floorMillis, unsigned long ceilingMillis);
+            void update(float tempF, float lowThresholdF, float highThresholdF, unsigned long now);
+
+            unsigned long  getInterval        ();
+            float          getRatePerMin      ();
+    };
+
+#endif
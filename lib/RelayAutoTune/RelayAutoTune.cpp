@@ -0,0 +1,277 @@
+/*
+  RelayAutoTune - Works out PID gains by switching the outlet on and off
+  around the desired temperature and measuring the swing that results.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include "RelayAutoTune.h"
+
+#include <math.h>
+
+// Name of each state in the same order as State...
+static const char *STATE_NAMES[] = {
+    "idle",
+    "running",
+    "done",
+    "failed"
+};
+
+/**
+ * #### CLASS CONSTRUCTOR ####
+ * Allows for external instantiation of
+ * the class into an object.
+*/
+RelayAutoTune::RelayAutoTune() {
+    state = IDLE;
+    desiredTemp = 0.0;
+    isHeat = true;
+    relayOn = false;
+    hasTemp = false;
+    startedAt = 0UL;
+    lastOnAt = 0UL;
+    onCount = 0U;
+    highest = 0.0;
+    lowest = 0.0;
+    peakSum = 0.0;
+    troughSum = 0.0;
+    peakCount = 0U;
+    troughCount = 0U;
+    periodSum = 0UL;
+    periodCount = 0U;
+    kp = 0.0;
+    ki = 0.0;
+    kd = 0.0;
+}
+
+/**
+ * Used to start auto-tuning around the given desired temperature. The
+ * outlet should then be switched as update() says until it is no longer
+ * running.
+ *
+ * @param desiredTemp The temperature to swing around as float.
+ * @param isHeat True if the outlet heats, false if it cools, as bool.
+ * @param now The current time in milliseconds as unsigned long.
+*/
+void RelayAutoTune::start(float desiredTemp, bool isHeat, unsigned long now) {
+    state = RUNNING;
+    this->desiredTemp = desiredTemp;
+    this->isHeat = isHeat;
+    relayOn = false;
+    hasTemp = false;
+    startedAt = now;
+    lastOnAt = 0UL;
+    onCount = 0U;
+    highest = 0.0;
+    lowest = 0.0;
+    peakSum = 0.0;
+    troughSum = 0.0;
+    peakCount = 0U;
+    troughCount = 0U;
+    periodSum = 0UL;
+    periodCount = 0U;
+}
+
+/**
+ * Used to give the auto-tune the latest temperature and to tell if the
+ * outlet should be on. Once enough oscillations have been measured the
+ * state becomes DONE and the gains can be had.
+ *
+ * @param temp The current temperature as float.
+ * @param now The current time in milliseconds as unsigned long.
+ *
+ * @return Returns true if the outlet should be on otherwise false as bool.
+*/
+bool RelayAutoTune::update(float temp, unsigned long now) {
+    if (state != RUNNING) { // Nothing to do...
+
+        return false;
+    }
+
+    if (now - startedAt >= RELAY_AUTO_TUNE_MAX_MS) { // Never settled into a swing...
+        state = FAILED;
+
+        return false;
+    }
+
+    if (!hasTemp) { // First temperature, start on the side that moves toward the desired temp...
+        hasTemp = true;
+        relayOn = (isHeat ? temp < desiredTemp : temp > desiredTemp);
+        highest = temp;
+        lowest = temp;
+        if (relayOn) {
+            lastOnAt = now;
+            onCount = 1U;
+        }
+
+        return relayOn;
+    }
+
+    if (temp > highest) {
+        highest = temp;
+    }
+    if (temp < lowest) {
+        lowest = temp;
+    }
+
+    bool tooWarm = temp > desiredTemp + RELAY_AUTO_TUNE_BAND_F;
+    bool tooCool = temp < desiredTemp - RELAY_AUTO_TUNE_BAND_F;
+    bool wantOn = relayOn;
+    if (isHeat) {
+        wantOn = (relayOn ? !tooWarm : tooCool);
+    } else {
+        wantOn = (relayOn ? !tooCool : tooWarm);
+    }
+    if (wantOn == relayOn) { // Keep going as is...
+
+        return relayOn;
+    }
+
+    // FYI: The temperature peaks while the outlet isn't heating, or while it is cooling...
+    bool leavingPeakPhase = (relayOn != isHeat);
+    if (onCount >= 2U) { // Past the first oscillation...
+        if (leavingPeakPhase) {
+            peakSum += highest;
+            peakCount++;
+        } else {
+            troughSum += lowest;
+            troughCount++;
+        }
+    }
+    highest = temp;
+    lowest = temp;
+
+    relayOn = wantOn;
+    if (relayOn) { // A new oscillation starts...
+        if (onCount >= 2U) {
+            periodSum += now - lastOnAt;
+            periodCount++;
+        }
+        lastOnAt = now;
+        if (onCount < UINT8_MAX) {
+            onCount++;
+        }
+        if (periodCount >= RELAY_AUTO_TUNE_CYCLES) {
+            finish();
+
+            return false;
+        }
+    }
+
+    return relayOn;
+}
+
+/**
+ * Used to stop auto-tuning without working out any gains.
+*/
+void RelayAutoTune::cancel() {
+    if (state == RUNNING) {
+        state = IDLE;
+    }
+}
+
+/**
+ * Used to get the state of the auto-tune.
+ *
+ * @return Returns the state as State.
+*/
+RelayAutoTune::State RelayAutoTune::getState() {
+
+    return state;
+}
+
+/**
+ * Used to get the number of oscillations measured so far.
+ *
+ * @return Returns the count as uint8_t.
+*/
+uint8_t RelayAutoTune::getCycleCount() {
+
+    return periodCount;
+}
+
+/**
+ * Used to get the proportional gain worked out.
+ *
+ * @return Returns the gain, valid once DONE, as float.
+*/
+float RelayAutoTune::getKp() {
+
+    return kp;
+}
+
+/**
+ * Used to get the integral gain worked out.
+ *
+ * @return Returns the gain, valid once DONE, as float.
+*/
+float RelayAutoTune::getKi() {
+
+    return ki;
+}
+
+/**
+ * Used to get the derivative gain worked out.
+ *
+ * @return Returns the gain, valid once DONE, as float.
+*/
+float RelayAutoTune::getKd() {
+
+    return kd;
+}
+
+/**
+ * Used to tell if the auto-tune is running.
+ *
+ * @return Returns true if running otherwise false as bool.
+*/
+bool RelayAutoTune::isRunning() {
+
+    return state == RUNNING;
+}
+
+/**
+ * Used to get the name of the given state as used by the status API.
+ *
+ * @param state The state as State.
+ *
+ * @return Returns the name as char pointer.
+*/
+const char* RelayAutoTune::getStateName(State state) {
+
+    return STATE_NAMES[state];
+}
+
+/*
+=================================================================
+Private Functions
+=================================================================
+*/
+
+/**
+ * #### PRIVATE ####
+ * Works out the gains from the oscillations measured.
+*/
+void RelayAutoTune::finish() {
+    if (peakCount == 0U || troughCount == 0U || periodCount == 0U) { // Not enough to go on...
+        state = FAILED;
+
+        return;
+    }
+
+    float amplitude = (peakSum / peakCount - troughSum / troughCount) / 2.0;
+    if (amplitude <= 0.0) { // Temperature didn't swing...
+        state = FAILED;
+
+        return;
+    }
+
+    // FYI: The relay swings the output between 0 and 1 so d is 0.5...
+    float ultimateGain = (4.0 * 0.5) / ((float) M_PI * amplitude);
+    float ultimateMinutes = ((float) periodSum / periodCount) / 60000.0;
+    kp = 0.2 * ultimateGain;
+    ki = kp / (ultimateMinutes / 2.0);
+    kd = kp * (ultimateMinutes / 3.0);
+    state = DONE;
+}
@@ -0,0 +1,88 @@
+#ifndef RelayAutoTune_h
+    #define RelayAutoTune_h
+
+    #include <stdint.h>
+
+    #ifndef RELAY_AUTO_TUNE_BAND_F
+        #define RELAY_AUTO_TUNE_BAND_F 0.3 // Distance either side of the desired temp the relay switches at
+    #endif
+
+    #ifndef RELAY_AUTO_TUNE_CYCLES
+        #define RELAY_AUTO_TUNE_CYCLES 3U // Full oscillations measured after the first is let settle
+    #endif
+
+    #ifndef RELAY_AUTO_TUNE_MAX_MS
+        #define RELAY_AUTO_TUNE_MAX_MS 21600000UL // Auto-tune gives up after this long
+    #endif
+
+    /*
+      CLASS: RelayAutoTune
+
+      This class works out PID gains for PidController by relay feedback. While it
+      runs it switches the outlet fully on and off around the desired temperature,
+      with RELAY_AUTO_TUNE_BAND_F of hysteresis so noise doesn't chatter the relay,
+      which makes the temperature swing steadily above and below it. The size of
+      that swing and how long each swing takes give the ultimate gain and period
+      of the room, Ku = 4d / (pi a) where d is half the relay's output range and a
+      is half the peak to trough swing, from which the gains are worked out with
+      the Ziegler-Nichols no-overshoot rule: kp = 0.2 Ku, Ti = Pu / 2, Td = Pu / 3.
+
+      The first oscillation is left out as the temperature won't have settled into
+      its swing yet. The gains are in the units PidController uses.
+
+      Nothing here depends on the device so it can be built and run on a host,
+      for instance against temperatures logged from /api/status.
+
+      Written by: Scott Griffis
+      Date: 10-16-2026
+    */
+    class RelayAutoTune {
+        public:
+            enum State : uint8_t {
+                IDLE = 0,
+                RUNNING,
+                DONE,
+                FAILED
+            };
+
+        private:
+            State          state                  ;
+            float          desiredTemp            ;
+            bool           isHeat                 ;
+            bool           relayOn                ;
+            bool           hasTemp                ;
+            unsigned long  startedAt              ;
+            unsigned long  lastOnAt               ;
+            uint8_t        onCount                ;
+            float          highest                ;
+            float          lowest                 ;
+            float          peakSum                ;
+            float          troughSum              ;
+            uint8_t        peakCount              ;
+            uint8_t        troughCount            ;
+            unsigned long  periodSum              ;
+            uint8_t        periodCount            ;
+            float          kp                     ;
+            float          ki                     ;
+            float          kd                     ;
+
+            void finish();
+
+        public:
+            RelayAutoTune();
+
+            void start(float desiredTemp, bool isHeat, unsigned long now);
+            bool update(float temp, unsigned long now);
+            void cancel();
+
+            State          getState               ();
+            uint8_t        getCycleCount          ();
+            float          getKp                  ();
+            float          getKi                  ();
+            float          getKd                  ();
+            bool           isRunning              ();
+
+            static const char* getStateName(State state);
+    };
+
+#endif
@@ -0,0 +1,213 @@
+/*
+  RelayGuard - Holds the outlet as it is while switching it would break its
+  minimum on and off times or its cycles per hour limit.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include "RelayGuard.h"
+
+#define RELAY_GUARD_HOUR_MS 3600000UL
+
+// Name of each hold in the same order as Hold...
+static const char *HOLD_NAMES[] = {
+    "none",
+    "min_on",
+    "min_off",
+    "max_cycles"
+};
+
+/**
+ * #### CLASS CONSTRUCTOR ####
+ * Allows for external instantiation of
+ * the class into an object.
+*/
+RelayGuard::RelayGuard() {
+    minOnMillis = 0UL;
+    minOffMillis = 0UL;
+    maxCyclesPerHour = 0U;
+    isOn = false;
+    changedAt = 0UL;
+    for (uint8_t i = 0U; i < RELAY_GUARD_MAX_CYCLES_PER_HOUR; i++) {
+        onAt[i] = 0UL;
+    }
+    onAtNext = 0U;
+    onAtCount = 0U;
+    hold = NONE;
+    holdEndsAt = 0UL;
+    toggleCount = 0UL;
+    holdCount = 0UL;
+}
+
+/**
+ * Used to set the limits. They take effect the next time apply() is called and
+ * are measured against the switching already done.
+ *
+ * @param minOnMillis How long the outlet must stay on once turned on as unsigned long.
+ * @param minOffMillis How long the outlet must stay off once turned off as unsigned long.
+ * @param maxCyclesPerHour How often the outlet may be turned on in any hour, zero being no limit, as uint8_t.
+*/
+void RelayGuard::setLimits(unsigned long minOnMillis, unsigned long minOffMillis, uint8_t maxCyclesPerHour) {
+    this->minOnMillis = minOnMillis;
+    this->minOffMillis = minOffMillis;
+    this->maxCyclesPerHour = (maxCyclesPerHour > RELAY_GUARD_MAX_CYCLES_PER_HOUR ? RELAY_GUARD_MAX_CYCLES_PER_HOUR : maxCyclesPerHour);
+}
+
+/**
+ * Used to work out what the outlet should be set to given what it is asked to
+ * be. The outlet must then be set as returned, as the guard takes that to be
+ * so.
+ *
+ * @param wantOn True if the outlet is asked to be on otherwise false as bool.
+ * @param now The current time in milliseconds as unsigned long.
+ *
+ * @return Returns true if the outlet should be on otherwise false as bool.
+*/
+bool RelayGuard::apply(bool wantOn, unsigned long now) {
+    if (wantOn == isOn) { // Nothing to switch...
+        hold = NONE;
+
+        return isOn;
+    }
+
+    Hold blockedBy = NONE;
+    unsigned long endsAt = now;
+    if (isOn) { // Wants turning off...
+        if (now - changedAt < minOnMillis) {
+            blockedBy = MIN_ON;
+            endsAt = changedAt + minOnMillis;
+        }
+    } else { // Wants turning on...
+        if (now - changedAt < minOffMillis) {
+            blockedBy = MIN_OFF;
+            endsAt = changedAt + minOffMillis;
+        } else if (maxCyclesPerHour > 0U && onAtCount >= maxCyclesPerHour) {
+            // FYI: The limit is reached if the oldest of the last maxCyclesPerHour turn ons is within the hour...
+            unsigned long oldest = getRecentOnAt(maxCyclesPerHour - 1U);
+            if (now - oldest < RELAY_GUARD_HOUR_MS) {
+                blockedBy = MAX_CYCLES;
+                endsAt = oldest + RELAY_GUARD_HOUR_MS;
+            }
+        }
+    }
+
+    if (blockedBy != NONE) { // Outlet is held as it is...
+        if (hold == NONE) {
+            holdCount++;
+        }
+        hold = blockedBy;
+        holdEndsAt = endsAt;
+
+        return isOn;
+    }
+
+    hold = NONE;
+    isOn = wantOn;
+    changedAt = now;
+    toggleCount++;
+    if (isOn) {
+        onAt[onAtNext] = now;
+        onAtNext = (onAtNext + 1U) % RELAY_GUARD_MAX_CYCLES_PER_HOUR;
+        if (onAtCount < RELAY_GUARD_MAX_CYCLES_PER_HOUR) {
+            onAtCount++;
+        }
+    }
+
+    return isOn;
+}
+
+/**
+ * Used to get what is holding the outlet as it is, as of the last apply().
+ *
+ * @return Returns the hold as Hold.
+*/
+RelayGuard::Hold RelayGuard::getHold() {
+
+    return hold;
+}
+
+/**
+ * Used to get how much longer the outlet will be held as it is.
+ *
+ * @param now The current time in milliseconds as unsigned long.
+ *
+ * @return Returns the time in milliseconds, zero when not held, as unsigned long.
+*/
+unsigned long RelayGuard::getHoldMillis(unsigned long now) {
+    if (hold == NONE || (long) (holdEndsAt - now) <= 0L) { // Not held...
+
+        return 0UL;
+    }
+
+    return holdEndsAt - now;
+}
+
+/**
+ * Used to get the number of times the outlet has been switched either way.
+ *
+ * @return Returns the count as unsigned long.
+*/
+unsigned long RelayGuard::getToggleCount() {
+
+    return toggleCount;
+}
+
+/**
+ * Used to get the number of times the outlet was held as it was when asked to
+ * switch.
+ *
+ * @return Returns the count as unsigned long.
+*/
+unsigned long RelayGuard::getHoldCount() {
+
+    return holdCount;
+}
+
+/**
+ * Used to get the number of times the outlet was turned on in the last hour,
+ * counting up to RELAY_GUARD_MAX_CYCLES_PER_HOUR.
+ *
+ * @param now The current time in milliseconds as unsigned long.
+ *
+ * @return Returns the count as uint8_t.
+*/
+uint8_t RelayGuard::getCyclesInLastHour(unsigned long now) {
+    uint8_t count = 0U;
+    while (count < onAtCount && now - getRecentOnAt(count) < RELAY_GUARD_HOUR_MS) {
+        count++;
+    }
+
+    return count;
+}
+
+/**
+ * Used to get the name of the given hold as used by the status API.
+ *
+ * @param hold The hold as Hold.
+ *
+ * @return Returns the name as char pointer.
+*/
+const char* RelayGuard::getHoldName(Hold hold) {
+
+    return HOLD_NAMES[hold];
+}
+
+/*
+=================================================================
+Private Functions
+=================================================================
+*/
+
+/**
+ * #### PRIVATE ####
+ * Gets the time of a recent turn on.
+ *
+ * @param back How many turn ons back to go, zero being the latest, as uint8_t.
+ *
+ * @return Returns the time in milliseconds as unsigned long.
+*/
+unsigned long RelayGuard::getRecentOnAt(uint8_t back) {
+
+    return onAt[(onAtNext + RELAY_GUARD_MAX_CYCLES_PER_HOUR - 1U - back) % RELAY_GUARD_MAX_CYCLES_PER_HOUR];
+}
@@ -0,0 +1,67 @@
+#ifndef RelayGuard_h
+    #define RelayGuard_h
+
+    #include <stdint.h>
+
+    #ifndef RELAY_GUARD_MAX_CYCLES_PER_HOUR
+        #define RELAY_GUARD_MAX_CYCLES_PER_HOUR 60U // Highest cycles per hour limit, storage is reserved for this many
+    #endif
+
+    /*
+      CLASS: RelayGuard
+
+      This class protects the outlet's relay, and whatever it powers, from being
+      switched too often. It sits between what the outlet is asked to be and what
+      it is set to, and holds the outlet as it is while switching it would break
+      one of its limits: it must have been on for at least the minimum on time
+      before it is turned off, off for at least the minimum off time before it is
+      turned on, and it may only be turned on so many times in any hour. The
+      outlet counts as having just been turned off at boot, so a compressor isn't
+      restarted straight after a power blip.
+
+      It also counts how often the outlet was switched and how often it was held.
+
+      Written by: Scott Griffis
+      Date: 10-16-2026
+    */
+    class RelayGuard {
+        public:
+            enum Hold : uint8_t {
+                NONE = 0,
+                MIN_ON,
+                MIN_OFF,
+                MAX_CYCLES
+            };
+
+        private:
+            unsigned long  minOnMillis            ;
+            unsigned long  minOffMillis           ;
+            uint8_t        maxCyclesPerHour       ; // Zero is no limit
+            bool           isOn                   ;
+            unsigned long  changedAt              ;
+            unsigned long  onAt     [RELAY_GUARD_MAX_CYCLES_PER_HOUR] ; // Recent turn on times, oldest overwritten
+            uint8_t        onAtNext               ;
+            uint8_t        onAtCount              ;
+            Hold           hold                   ;
+            unsigned long  holdEndsAt             ;
+            unsigned long  toggleCount            ;
+            unsigned long  holdCount              ;
+
+            unsigned long getRecentOnAt(uint8_t back);
+
+        public:
+            RelayGuard();
+
+            void setLimits(unsigned long minOnMillis, unsigned long minOffMillis, uint8_t maxCyclesPerHour);
+            bool apply(bool wantOn, unsigned long now);
+
+            Hold           getHold                ();
+            unsigned long  getHoldMillis          (unsigned long now);
+            unsigned long  getToggleCount         ();
+            unsigned long  getHoldCount           ();
+            uint8_t        getCyclesInLastHour    (unsigned long now);
+
+            static const char* getHoldName(Hold hold);
+    };
+
+#endif
@@ -0,0 +1,135 @@
+/*
+  ResponseWriter - A fixed size output buffer which collects the pieces of a
+  response and hands them to a sink in buffer sized chunks.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include "ResponseWriter.h"
+
+/**
+ * #### CLASS CONSTRUCTOR ####
+ * Allows for external instantiation of
+ * the class into an object.
+*/
+ResponseWriter::ResponseWriter() {
+    length = 0U;
+    sink = nullptr;
+    sinkP = nullptr;
+}
+
+/**
+ * Used to start a new response. Any data that is written after this call
+ * is delivered to the given sink(s).
+ *
+ * @param sink The function that receives the buffered data as Sink.
+ * @param sinkP OPTIONAL PARAM, the function that receives large runs of
+ * PROGMEM data directly; if not given such data is copied through the buffer,
+ * as SinkP.
+*/
+void ResponseWriter::begin(Sink sink, SinkP sinkP) {
+    this->length = 0U;
+    this->sink = sink;
+    this->sinkP = sinkP;
+}
+
+/**
+ * Used to finish the current response. Anything remaining in the
+ * buffer is delivered and the sinks are released.
+*/
+void ResponseWriter::end() {
+    flush();
+    sink = nullptr;
+    sinkP = nullptr;
+}
+
+/**
+ * Writes a single byte into the buffer.
+ *
+ * @param c The byte to write as uint8_t.
+ *
+ * @return Returns the number of bytes written as size_t.
+*/
+size_t ResponseWriter::write(uint8_t c) {
+    if (length >= sizeof(buffer)) { // Buffer is full...
+        flush();
+    }
+    buffer[length++] = (char) c;
+
+    return 1U;
+}
+
+/**
+ * Writes the given data into the buffer, delivering the buffer
+ * to the sink each time it fills up.
+ *
+ * @param data The data to write as uint8_t pointer.
+ * @param length The number of bytes to write as size_t.
+ *
+ * @return Returns the number of bytes written as size_t.
+*/
+size_t ResponseWriter::write(const uint8_t *data, size_t length) {
+    size_t remaining = length;
+    while (remaining > 0U) { // More to write...
+        if (this->length >= sizeof(buffer)) { // Buffer is full...
+            flush();
+        }
+        size_t count = sizeof(buffer) - this->length;
+        if (count > remaining) {
+            count = remaining;
+        }
+        memcpy(buffer + this->length, data, count);
+        this->length += count;
+        data += count;
+        remaining -= count;
+    }
+
+    return length;
+}
+
+/**
+ * Writes the given PROGMEM data. Runs that are larger than the buffer are
+ * handed directly to the PROGMEM sink when there is one, everything else is
+ * copied into the buffer.
+ *
+ * @param data The PROGMEM data to write as PGM_P.
+ * @param length The number of bytes to write as size_t.
+ *
+ * @return Returns the number of bytes written as size_t.
+*/
+size_t ResponseWriter::write_P(PGM_P data, size_t length) {
+    if (length >= sizeof(buffer) && sinkP) { // Big enough to send as is...
+        flush();
+        sinkP(data, length);
+
+        return length;
+    }
+
+    size_t remaining = length;
+    while (remaining > 0U) { // More to write...
+        if (this->length >= sizeof(buffer)) { // Buffer is full...
+            flush();
+        }
+        size_t count = sizeof(buffer) - this->length;
+        if (count > remaining) {
+            count = remaining;
+        }
+        memcpy_P(buffer + this->length, data, count);
+        this->length += count;
+        data += count;
+        remaining -= count;
+    }
+
+    return length;
+}
+
+/**
+ * Delivers whatever is currently in the buffer to the sink.
+*/
+void ResponseWriter::flush() {
+    if (length > 0U && sink) { // Something to deliver...
+        sink(buffer, length);
+    }
+    length = 0U;
+}
@@ -0,0 +1,50 @@
+#ifndef ResponseWriter_h
+    #define ResponseWriter_h
+
+    #include <Print.h>
+    #include <pgmspace.h>
+    #include <functional>
+
+    #ifndef RESPONSE_WRITER_BUFFER_SIZE
+        #define RESPONSE_WRITER_BUFFER_SIZE 512U
+    #endif
+
+    /*
+      CLASS: ResponseWriter
+
+      This class is a small fixed size output buffer which sits between the code
+      that generates a response and the web server that delivers it. Data written
+      to it is collected into its buffer and handed off to the configured sink
+      whenever the buffer fills up, so no matter how large a page is the memory
+      used to produce it never exceeds the size of the buffer. Large runs of
+      PROGMEM data are handed directly to the PROGMEM sink without being copied.
+
+      Written by: Scott Griffis
+      Date: 10-16-2026
+    */
+    class ResponseWriter : public Print {
+        public:
+            typedef std::function<void(const char *data, size_t length)> Sink;
+            typedef std::function<void(PGM_P data, size_t length)> SinkP;
+
+        private:
+            char     buffer     [RESPONSE_WRITER_BUFFER_SIZE]  ;
+            size_t   length                                    ;
+            Sink     sink                                      ;
+            SinkP    sinkP                                     ;
+
+        public:
+            ResponseWriter();
+
+            void begin(Sink sink, SinkP sinkP = nullptr);
+            void end();
+
+            size_t write(uint8_t c) override;
+            size_t write(const uint8_t *data, size_t length) override;
+            size_t write_P(PGM_P data, size_t length);
+            void flush() override;
+
+            using Print::write;
+    };
+
+#endif
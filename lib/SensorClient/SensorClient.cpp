@@ -0,0 +1,759 @@
+/*
+  SensorClient - Handles reading the temperature from a TempBuddy Sensor over a
+  persistent, resumable TLS connection without holding up the rest of the device.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include "SensorClient.h"
+
+// Name of each phase in the same order as Phase...
+static const char *PHASE_NAMES[] = {
+    "idle",
+    "resolve",
+    "connect",
+    "send",
+    "headers",
+    "body",
+    "parse"
+};
+
+JsonArena SensorClient::arena;
+JsonDocument SensorClient::doc(&SensorClient::arena);
+JsonDocument SensorClient::filter;
+HostResolver *SensorClient::resolver = nullptr;
+
+/**
+ * #### CLASS CONSTRUCTOR ####
+ * Allows for external instantiation of
+ * the class into an object.
+*/
+SensorClient::SensorClient() {
+    host = "";
+    phase = IDLE;
+    lastFailedPhase = IDLE;
+    connectTimeout = SENSOR_CLIENT_CONNECT_TIMEOUT_MS;
+    readTimeout = SENSOR_CLIENT_READ_TIMEOUT_MS;
+    phaseStart = 0UL;
+    fetchStart = 0UL;
+    lineLength = 0U;
+    bodyLength = 0U;
+    contentLength = -1L;
+    statusCode = 0;
+    keepAlive = false;
+    mflnChecked = false;
+    lastResumed = false;
+    lastReused = false;
+    lastHandshakeMillis = 0UL;
+    handshakeCount = 0UL;
+    resumedCount = 0UL;
+    failureCount = 0UL;
+    lastLatencyMillis = 0UL;
+    lastHumidity = NAN;
+}
+
+/**
+ * Used to set the host of the sensor to read from. If the host differs from
+ * the current one then any read in progress is abandoned and the current
+ * connection and session are dropped.
+ *
+ * @param host The host of the TempBuddy Sensor as char pointer.
+*/
+void SensorClient::begin(const char *host) {
+    if (this->host.equals(host)) { // Nothing changed...
+
+        return;
+    }
+
+    client.stop();
+    session = BearSSL::Session();
+    mflnChecked = false;
+    breaker.reset();
+    enterPhase(IDLE);
+    this->host = host;
+}
+
+/**
+ * Used to set how long a read may wait on the sensor. The connect timeout
+ * covers the TCP connect and TLS handshake, the read timeout applies to each
+ * of sending the request, receiving the headers and receiving the body.
+ *
+ * @param connectMillis The connect timeout in milliseconds as unsigned long.
+ * @param readMillis The read timeout in milliseconds as unsigned long.
+*/
+void SensorClient::setTimeouts(unsigned long connectMillis, unsigned long readMillis) {
+    connectTimeout = connectMillis;
+    readTimeout = readMillis;
+}
+
+/**
+ * Used to start reading the temperature from the sensor. The read is then
+ * carried out by calls to run(). If the connection from the last read is
+ * still open it is reused and no handshake is needed. No read is started
+ * while the circuit breaker is open.
+ *
+ * @return Returns true if a read was started otherwise false as bool.
+*/
+bool SensorClient::start() {
+    if (phase != IDLE || host.isEmpty()) { // Busy or nothing to read from...
+
+        return false;
+    }
+
+    if (!breaker.allow(millis())) { // Backing off from the sensor...
+
+        return false;
+    }
+
+    lineLength = 0U;
+    bodyLength = 0U;
+    contentLength = -1L;
+    statusCode = 0;
+    keepAlive = false;
+
+    fetchStart = millis();
+    lastReused = client.connected();
+    enterPhase(lastReused ? SEND : RESOLVE);
+
+    return true;
+}
+
+/**
+ * Used to carry a read started by start() forward by a small, bounded amount
+ * of work. This is intended to be called every time through the loop.
+ *
+ * @param centiF Receives the temperature in hundredths of a degree F when a read completes, as int16_t reference.
+ *
+ * @return Returns true only on the call that completes a read successfully otherwise false as bool.
+*/
+bool SensorClient::run(int16_t &centiF) {
+    if (phase == IDLE) { // Nothing to do...
+
+        return false;
+    }
+
+    unsigned long timeout = phaseTimeout();
+    if (timeout > 0UL && millis() - phaseStart >= timeout) { // Phase took too long...
+        fail();
+
+        return false;
+    }
+
+    switch (phase) {
+        case RESOLVE:
+            if (resolver != nullptr) { // Names can be resolved...
+                if (resolver->resolve(host, address)) {
+                    enterPhase(CONNECT);
+                } // FYI: Otherwise the look up is still going, the phase's timeout gives up on it.
+            } else if (address.fromString(host)) {
+                enterPhase(CONNECT);
+            } else {
+                fail();
+            }
+            break;
+        case CONNECT: {
+            bool wasMflnChecked = mflnChecked;
+            if (connect()) {
+                enterPhase(SEND);
+            } else if (!wasMflnChecked && mflnChecked) { // Sensor turned down MFLN...
+                // FYI: The next call tries again with full buffers, within what's left of the phase's timeout.
+            } else {
+                fail();
+            }
+            break;
+        }
+        case SEND: {
+            // FYI: The body buffer isn't in use yet so the request is built there...
+            int length = snprintf_P(
+                body,
+                sizeof(body),
+                PSTR("GET /api/info HTTP/1.1\r\nHost: %s\r\nConnection: keep-alive\r\n\r\n"),
+                host.c_str()
+            );
+            if (length <= 0 || (size_t) length >= sizeof(body)) { // Request didn't fit...
+                fail();
+            } else if (client.write((const uint8_t*) body, length) == (size_t) length) {
+                enterPhase(HEADERS);
+            } else if (lastReused) { // Sensor closed the kept connection, make a new one...
+                client.stop();
+                lastReused = false;
+                enterPhase(RESOLVE);
+            } else {
+                fail();
+            }
+            break;
+        }
+        case HEADERS:
+            readHeaders();
+            break;
+        case BODY:
+            readBody();
+            break;
+        case PARSE:
+            if (parse(centiF)) {
+                if (!keepAlive) { // Sensor won't keep the connection open...
+                    client.stop();
+                }
+                lastLatencyMillis = millis() - fetchStart;
+                breaker.recordSuccess();
+                enterPhase(IDLE);
+
+                return true;
+            }
+            fail();
+            break;
+        default:
+            break;
+    }
+
+    return false;
+}
+
+/**
+ * Used to tell if a read is in progress.
+ *
+ * @return Returns true if busy otherwise false as bool.
+*/
+bool SensorClient::isBusy() {
+
+    return phase != IDLE;
+}
+
+/**
+ * Used to get the phase the current read is in.
+ *
+ * @return Returns the phase as Phase.
+*/
+SensorClient::Phase SensorClient::getPhase() {
+
+    return phase;
+}
+
+/**
+ * Used to get the phase the most recent failed read failed in.
+ *
+ * @return Returns the phase, or IDLE if no read has failed, as Phase.
+*/
+SensorClient::Phase SensorClient::getLastFailedPhase() {
+
+    return lastFailedPhase;
+}
+
+/**
+ * Used to tell if the most recent handshake resumed the prior session.
+ *
+ * @return Returns true if resumed otherwise false as bool.
+*/
+bool SensorClient::getLastResumed() {
+
+    return lastResumed;
+}
+
+/**
+ * Used to tell if the most recent read reused an already open connection
+ * and so needed no handshake at all.
+ *
+ * @return Returns true if reused otherwise false as bool.
+*/
+bool SensorClient::getLastReused() {
+
+    return lastReused;
+}
+
+/**
+ * Used to get how long the most recent handshake took.
+ *
+ * @return Returns the handshake time in milliseconds as unsigned long.
+*/
+unsigned long SensorClient::getLastHandshakeMillis() {
+
+    return lastHandshakeMillis;
+}
+
+/**
+ * Used to get the number of handshakes performed.
+ *
+ * @return Returns the count as unsigned long.
+*/
+unsigned long SensorClient::getHandshakeCount() {
+
+    return handshakeCount;
+}
+
+/**
+ * Used to get the number of handshakes that resumed the prior session.
+ *
+ * @return Returns the count as unsigned long.
+*/
+unsigned long SensorClient::getResumedCount() {
+
+    return resumedCount;
+}
+
+/**
+ * Used to get the number of reads that have failed.
+ *
+ * @return Returns the count as unsigned long.
+*/
+unsigned long SensorClient::getFailureCount() {
+
+    return failureCount;
+}
+
+/**
+ * Used to get how long the most recent successful read took from start to
+ * finish.
+ *
+ * @return Returns the time in milliseconds as unsigned long.
+*/
+unsigned long SensorClient::getLastLatencyMillis() {
+
+    return lastLatencyMillis;
+}
+
+/**
+ * Used to get the host of the sensor being read.
+ *
+ * @return Returns the host as String reference.
+*/
+const String& SensorClient::getHost() {
+
+    return host;
+}
+
+/**
+ * Used to get the address the sensor was last resolved to.
+ *
+ * @return Returns the address, unset if never resolved, as IPAddress.
+*/
+IPAddress SensorClient::getAddress() {
+
+    return address;
+}
+
+/**
+ * Used to get the humidity from the most recent successful read.
+ *
+ * @return Returns the humidity in percent, or NAN if the sensor didn't send one, as float.
+*/
+float SensorClient::getLastHumidity() {
+
+    return lastHumidity;
+}
+
+/**
+ * Used to get the state of the circuit breaker guarding reads.
+ *
+ * @return Returns the state as CircuitBreaker::State.
+*/
+CircuitBreaker::State SensorClient::getBreakerState() {
+
+    return breaker.getState();
+}
+
+/**
+ * Used to get the number of reads that have failed in a row.
+ *
+ * @return Returns the count as uint8_t.
+*/
+uint8_t SensorClient::getConsecutiveFailures() {
+
+    return breaker.getConsecutiveFailures();
+}
+
+/**
+ * Used to get how long until the circuit breaker allows another read.
+ *
+ * @return Returns the time in milliseconds, or zero if not backing off, as unsigned long.
+*/
+unsigned long SensorClient::getRetryInMillis() {
+
+    return breaker.getRetryInMillis(millis());
+}
+
+/**
+ * Used to get the number of times the circuit breaker has opened.
+ *
+ * @return Returns the count as unsigned long.
+*/
+unsigned long SensorClient::getBreakerTripCount() {
+
+    return breaker.getTripCount();
+}
+
+/**
+ * Used to set the resolver every SensorClient uses to resolve host names.
+ * Without one only dot notation IPs can be read from.
+ *
+ * @param resolver The resolver as HostResolver pointer.
+*/
+void SensorClient::setResolver(HostResolver *resolver) {
+    SensorClient::resolver = resolver;
+}
+
+/**
+ * Used to get the name of the given phase.
+ *
+ * @param phase The phase to get the name of as Phase.
+ *
+ * @return Returns the name as char pointer.
+*/
+const char* SensorClient::getPhaseName(Phase phase) {
+
+    return PHASE_NAMES[phase];
+}
+
+/**
+ * Decodes the sensor's temp_unit value, which is either an 'F' or a 'C' in
+ * either case.
+ *
+ * @param unit The value of temp_unit as char pointer.
+ *
+ * @return Returns the decoded unit as TempUnit.
+*/
+SensorClient::TempUnit SensorClient::decodeUnit(const char *unit) {
+    if (unit == nullptr || unit[0] == '\0' || unit[1] != '\0') { // Not a single letter...
+
+        return UNIT_UNKNOWN;
+    }
+
+    switch (unit[0]) {
+        case 'f':
+        case 'F':
+
+            return UNIT_F;
+        case 'c':
+        case 'C':
+
+            return UNIT_C;
+        default:
+
+            return UNIT_UNKNOWN;
+    }
+}
+
+/**
+ * Decodes a temperature and its temp_unit, as sent by a sensor, into hundredths
+ * of a degree F. Whole numbers, and temperatures sent as text such as "71.6",
+ * are taken without going through a float.
+ *
+ * @param temp The value of temp as JsonVariantConst.
+ * @param unit The value of temp_unit as char pointer.
+ * @param centiF Receives the temperature in hundredths of a degree F as int16_t reference.
+ *
+ * @return Returns true if both were understood otherwise false as bool.
+*/
+bool SensorClient::decodeTemp(JsonVariantConst temp, const char *unit, int16_t &centiF) {
+    TempUnit decodedUnit = decodeUnit(unit);
+    if (decodedUnit == UNIT_UNKNOWN) { // Not a reading...
+
+        return false;
+    }
+
+    int16_t centi = 0;
+    if (temp.is<const char*>()) { // Sent as text...
+        if (!CentiTemp::parse(temp.as<const char*>(), centi)) {
+
+            return false;
+        }
+    } else if (temp.is<int>()) { // Whole degrees...
+        centi = CentiTemp::clamp((int32_t) temp.as<int>() * 100);
+    } else if (temp.is<float>()) {
+        centi = CentiTemp::fromFloat(temp.as<float>());
+    } else { // Not a reading...
+
+        return false;
+    }
+    centiF = (decodedUnit == UNIT_C ? CentiTemp::celsiusToFahrenheit(centi) : centi);
+
+    return true;
+}
+
+/*
+=================================================================
+Private Functions
+=================================================================
+*/
+
+/**
+ * #### PRIVATE ####
+ * Moves the read on to the given phase, starting the clock on its timeout.
+ *
+ * @param next The phase to move to as Phase.
+*/
+void SensorClient::enterPhase(Phase next) {
+    phase = next;
+    phaseStart = millis();
+}
+
+/**
+ * #### PRIVATE ####
+ * Gets the timeout of the current phase.
+ *
+ * @return Returns the timeout in milliseconds, zero meaning none, as unsigned long.
+*/
+unsigned long SensorClient::phaseTimeout() {
+    switch (phase) {
+        case RESOLVE:
+
+            return SENSOR_CLIENT_RESOLVE_TIMEOUT_MS;
+        case CONNECT:
+
+            return connectTimeout;
+        case SEND:
+        case HEADERS:
+        case BODY:
+
+            return readTimeout;
+        default:
+
+            return 0UL;
+    }
+}
+
+/**
+ * #### PRIVATE ####
+ * Abandons the read in progress. The connection is closed as it may be part
+ * way through a response, but the session is kept for resumption.
+*/
+void SensorClient::fail() {
+    Serial.printf("TempBuddy '%s' read failed during the '%s' phase.\n", host.c_str(), getPhaseName(phase));
+    lastFailedPhase = phase;
+    failureCount++;
+    client.stop();
+    enterPhase(IDLE);
+
+    unsigned long now = millis();
+    unsigned long tripCount = breaker.getTripCount();
+    breaker.recordFailure(now);
+    if (breaker.getTripCount() != tripCount) { // Breaker just opened...
+        Serial.printf("TempBuddy '%s' backed off for %lu seconds.\n", host.c_str(), breaker.getRetryInMillis(now) / 1000UL);
+    }
+}
+
+/**
+ * #### PRIVATE ####
+ * Makes one attempt at opening a new connection to the sensor, offering the
+ * prior session for resumption. The first connection to a host asks for
+ * Maximum Fragment Length as part of the handshake itself, and keeps the
+ * smaller buffers only if the sensor agrees. If the sensor doesn't, full
+ * buffers are used from then on and false is returned with mflnChecked set,
+ * so that the next attempt, within the same CONNECT phase, uses them.
+ *
+ * BearSSL's handshake can't be split up, so the attempt blocks. It is given
+ * only what is left of the connect timeout, half for the TCP connect and half
+ * for the handshake as the core times each on its own, so that the CONNECT
+ * phase as a whole never stalls the device for longer than the connect timeout.
+ *
+ * @return Returns true if connected otherwise false as bool.
+*/
+bool SensorClient::connect() {
+    unsigned long elapsed = millis() - phaseStart;
+    unsigned long left = (elapsed < connectTimeout ? connectTimeout - elapsed : 0UL);
+    bool isAskingMfln = !mflnChecked;
+    if (isAskingMfln) { // Haven't checked this host for MFLN support yet...
+        client.setBufferSizes(SENSOR_CLIENT_MFLN_SIZE, SENSOR_CLIENT_MFLN_SIZE);
+    }
+
+    client.setInsecure();
+    client.setSession(&session);
+    client.setTimeout(left / 2UL);
+
+    // FYI: BearSSL::Session is opaque; when the handshake resumes the offered
+    // session its parameters come back unchanged, a full handshake replaces them.
+    BearSSL::Session offered = session;
+    BearSSL::Session empty;
+    bool hadSession = memcmp(&offered, &empty, sizeof(BearSSL::Session)) != 0;
+
+    unsigned long start = millis();
+    bool isConnected = client.connect(address, 443);
+    if (isAskingMfln) {
+        if (isConnected && client.getMFLNStatus()) { // Sensor agreed to the smaller buffers...
+            mflnChecked = true;
+        } else if (isConnected || client.getLastSSLError() == BR_ERR_TOO_LARGE) { // Sensor won't limit its records...
+            client.stop();
+            client.setBufferSizes(SENSOR_CLIENT_FULL_RECV_SIZE, SENSOR_CLIENT_MFLN_SIZE);
+            mflnChecked = true;
+
+            return false;
+        } // FYI: Otherwise the sensor couldn't be reached, so it is asked again next time.
+    }
+    if (!isConnected) { // Handshake failed...
+
+        return false;
+    }
+    lastHandshakeMillis = millis() - start;
+    handshakeCount++;
+
+    lastResumed = hadSession && memcmp(&offered, &session, sizeof(BearSSL::Session)) == 0;
+    if (lastResumed) {
+        resumedCount++;
+    }
+
+    return true;
+}
+
+/**
+ * #### PRIVATE ####
+ * Reads what is available of the response's status line and headers, up
+ * to SENSOR_CLIENT_STEP_BYTES, moving on to BODY once the blank line that
+ * ends them is read.
+*/
+void SensorClient::readHeaders() {
+    if (!client.available() && !client.connected()) { // Sensor hung up...
+        fail();
+
+        return;
+    }
+
+    size_t budget = SENSOR_CLIENT_STEP_BYTES;
+    while (phase == HEADERS && budget > 0U && client.available()) {
+        budget--;
+        int c = client.read();
+        if (c < 0) { // Nothing after all...
+
+            break;
+        }
+
+        if (c == '\n') { // End of a line...
+            if (lineLength > 0U && line[lineLength - 1U] == '\r') {
+                lineLength--;
+            }
+            line[lineLength] = '\0';
+            handleHeaderLine();
+            lineLength = 0U;
+        } else if (lineLength < sizeof(line) - 1U) {
+            line[lineLength++] = (char) c;
+        }
+    }
+}
+
+/**
+ * #### PRIVATE ####
+ * Handles a complete line of the response's status line and headers that
+ * has been read into line.
+*/
+void SensorClient::handleHeaderLine() {
+    if (statusCode == 0) { // It's the status line...
+        if (strncmp_P(line, PSTR("HTTP/1."), 7) != 0 || lineLength < 12U) { // Not HTTP...
+            fail();
+
+            return;
+        }
+        keepAlive = (line[7] == '1'); // FYI: HTTP/1.1 is keep-alive unless told otherwise
+        statusCode = atoi(line + 9);
+
+        return;
+    }
+
+    if (lineLength == 0U) { // End of the headers...
+        if (statusCode < 200 || statusCode > 299) { // Not a good response...
+            Serial.printf("Got a '%d' response code from TempBuddy.\n", statusCode);
+            fail();
+        } else if (contentLength >= (long) sizeof(body)) { // Body won't fit...
+            fail();
+        } else if (contentLength == 0L) { // No body...
+            fail();
+        } else {
+            enterPhase(BODY);
+        }
+
+        return;
+    }
+
+    const char *value = strchr(line, ':');
+    if (value == nullptr) { // Not a header...
+
+        return;
+    }
+    value++;
+    while (*value == ' ') {
+        value++;
+    }
+
+    if (strncasecmp_P(line, PSTR("content-length:"), 15) == 0) {
+        contentLength = atol(value);
+    } else if (strncasecmp_P(line, PSTR("connection:"), 11) == 0) {
+        keepAlive = (strncasecmp_P(value, PSTR("close"), 5) != 0);
+    } else if (strncasecmp_P(line, PSTR("transfer-encoding:"), 18) == 0) {
+        if (strncasecmp_P(value, PSTR("chunked"), 7) == 0) { // Sensor doesn't send these...
+            fail();
+        }
+    }
+}
+
+/**
+ * #### PRIVATE ####
+ * Reads what is available of the response's body into body, up to
+ * SENSOR_CLIENT_STEP_BYTES, moving on to PARSE once all of it is read.
+ * Without a Content-Length the body ends when the sensor hangs up.
+*/
+void SensorClient::readBody() {
+    size_t wanted = SENSOR_CLIENT_STEP_BYTES;
+    if (contentLength >= 0L && (size_t) contentLength - bodyLength < wanted) {
+        wanted = (size_t) contentLength - bodyLength;
+    }
+    if (sizeof(body) - bodyLength < wanted) {
+        wanted = sizeof(body) - bodyLength;
+    }
+
+    int available = client.available();
+    if (available > 0 && wanted > 0U) { // Something to read...
+        if ((size_t) available < wanted) {
+            wanted = (size_t) available;
+        }
+        int count = client.read((uint8_t*) body + bodyLength, wanted);
+        if (count > 0) {
+            bodyLength += (size_t) count;
+        }
+    }
+
+    if (contentLength >= 0L) { // Length is known...
+        if (bodyLength == (size_t) contentLength) { // Have it all...
+            enterPhase(PARSE);
+        } else if (!client.connected() && !client.available()) { // Sensor hung up early...
+            fail();
+        }
+    } else if (!client.connected() && !client.available()) { // Body ended with the connection...
+        keepAlive = false;
+        enterPhase(PARSE);
+    } else if (bodyLength == sizeof(body)) { // Body won't fit...
+        fail();
+    }
+}
+
+/**
+ * #### PRIVATE ####
+ * Parses the temperature, and humidity if there is one, out of the body that
+ * was read. Everything else in the body is skipped by the filter.
+ *
+ * @param centiF Receives the temperature in hundredths of a degree F as int16_t reference.
+ *
+ * @return Returns true if the temperature was found otherwise false as bool.
+*/
+bool SensorClient::parse(int16_t &centiF) {
+    if (filter.isNull()) { // First parse sets up the shared filter...
+        // Only these fields of the sensor's response are kept...
+        filter["temp"] = true;
+        filter["temp_unit"] = true;
+        filter["humidity"] = true;
+    }
+
+    DeserializationError error = deserializeJson(doc, (const char*) body, bodyLength, DeserializationOption::Filter(filter));
+    if (error) { // Not valid JSON...
+        Serial.printf("TempBuddy response couldn't be parsed: %s\n", error.c_str());
+
+        return false;
+    }
+
+    if (!decodeTemp(doc["temp"], doc["temp_unit"], centiF)) { // No temperature or unknown unit...
+
+        return false;
+    }
+
+    JsonVariantConst humidity = doc["humidity"];
+    lastHumidity = (humidity.is<float>() ? humidity.as<float>() : NAN);
+
+    return true;
+}
@@ -0,0 +1,172 @@
+#ifndef SensorClient_h
+    #define SensorClient_h
+
+    #include <WiFiClientSecure.h>
+    #include <IPAddress.h>
+    #include <ArduinoJson.h>
+    #include <JsonArena.h>
+    #include <CircuitBreaker.h>
+    #include <HostResolver.h>
+    #include <CentiTemp.h>
+    #include <WString.h>
+
+    #ifndef SENSOR_CLIENT_MFLN_SIZE
+        #define SENSOR_CLIENT_MFLN_SIZE 512U // Buffer size used when the sensor supports MFLN
+    #endif
+
+    #define SENSOR_CLIENT_FULL_RECV_SIZE 16384U // Receive buffer size when it doesn't, the largest TLS record
+
+    #ifndef SENSOR_CLIENT_STEP_BYTES
+        #define SENSOR_CLIENT_STEP_BYTES 128U // Most bytes read from the sensor per call to run()
+    #endif
+
+    #ifndef SENSOR_CLIENT_LINE_SIZE
+        #define SENSOR_CLIENT_LINE_SIZE 96U // Longest response header line kept, longer ones are cut short
+    #endif
+
+    #ifndef SENSOR_CLIENT_BODY_SIZE
+        #define SENSOR_CLIENT_BODY_SIZE 512U // Largest response body accepted
+    #endif
+
+    #ifndef SENSOR_CLIENT_RESOLVE_TIMEOUT_MS
+        #define SENSOR_CLIENT_RESOLVE_TIMEOUT_MS 4000UL // How long to wait on the resolver for an address
+    #endif
+
+    #ifndef SENSOR_CLIENT_CONNECT_TIMEOUT_MS
+        #define SENSOR_CLIENT_CONNECT_TIMEOUT_MS 4000UL // Covers the TCP connect and the TLS handshake together
+    #endif
+
+    #ifndef SENSOR_CLIENT_READ_TIMEOUT_MS
+        #define SENSOR_CLIENT_READ_TIMEOUT_MS 4000UL // Applies to each of the send, headers and body phases
+    #endif
+
+    /*
+      CLASS: SensorClient
+
+      This class handles reading the temperature from a TempBuddy Sensor. Its TLS
+      connection is kept open between reads when the sensor allows HTTP keep-alive,
+      and the TLS session is kept so that a new connection can resume it instead of
+      doing a full handshake. If the sensor agrees to Maximum Fragment Length
+      negotiation in the first handshake then smaller TLS buffers are used to
+      save RAM.
+
+      A read is done as a series of phases, see Phase, which are advanced a little
+      at a time by calls to run() so that a read never holds up the rest of the
+      device for long. Each phase has its own timeout, see setTimeouts(). The
+      exception is CONNECT, as BearSSL's handshake can't be split up, so each
+      attempt at it blocks. Every attempt is given only what is left of the
+      connect timeout, so the phase stalls the device for at most the connect
+      timeout in all. It takes two attempts only the first time a host that
+      turns down MFLN is connected to, and is skipped entirely when the open
+      connection can be reused.
+
+      The host may be a name, which is resolved through the HostResolver given to
+      setResolver() so that the RESOLVE phase never waits on a look up; it just
+      waits for the resolver to have an address, within its timeout.
+
+      Reads are guarded by a CircuitBreaker, so a sensor that keeps failing is
+      backed off from rather than tried, and timed out on, every poll.
+
+      Responses are parsed with a filter that keeps only the fields that are used,
+      into a document that is reused for every read and whose memory comes from a
+      JsonArena, so a read doesn't allocate anything from the heap. As a response
+      is parsed all at once the document is shared by every SensorClient, so that
+      several sensors can be read at the same time.
+
+      Written by: Scott Griffis
+      Date: 10-16-2026
+    */
+    class SensorClient {
+        public:
+            enum Phase : uint8_t {
+                IDLE = 0,
+                RESOLVE,
+                CONNECT,
+                SEND,
+                HEADERS,
+                BODY,
+                PARSE
+            };
+
+            enum TempUnit : uint8_t {
+                UNIT_UNKNOWN = 0,
+                UNIT_F,
+                UNIT_C
+            };
+
+        private:
+            BearSSL::WiFiClientSecure  client                             ;
+            BearSSL::Session           session                            ;
+            CircuitBreaker             breaker                            ;
+            static JsonArena           arena                              ;
+            static JsonDocument        doc                                ;
+            static JsonDocument        filter                             ;
+            static HostResolver        *resolver                          ;
+
+            String                     host                               ;
+            IPAddress                  address                            ;
+            Phase                      phase                              ;
+            Phase                      lastFailedPhase                    ;
+            unsigned long              connectTimeout                     ;
+            unsigned long              readTimeout                        ;
+            unsigned long              phaseStart                         ;
+            unsigned long              fetchStart                         ;
+            char                       line       [SENSOR_CLIENT_LINE_SIZE] ;
+            size_t                     lineLength                         ;
+            char                       body       [SENSOR_CLIENT_BODY_SIZE] ;
+            size_t                     bodyLength                         ;
+            long                       contentLength                      ;
+            int                        statusCode                         ;
+            bool                       keepAlive                          ;
+            bool                       mflnChecked                        ;
+            bool                       lastResumed                        ;
+            bool                       lastReused                         ;
+            unsigned long              lastHandshakeMillis                ;
+            unsigned long              handshakeCount                     ;
+            unsigned long              resumedCount                       ;
+            unsigned long              failureCount                       ;
+            unsigned long              lastLatencyMillis                  ;
+            float                      lastHumidity                       ;
+
+            void enterPhase(Phase next);
+            unsigned long phaseTimeout();
+            void fail();
+            bool connect();
+            void readHeaders();
+            void handleHeaderLine();
+            void readBody();
+            bool parse(int16_t &centiF);
+
+        public:
+            SensorClient();
+
+            void begin(const char *host);
+            void setTimeouts(unsigned long connectMillis, unsigned long readMillis);
+            bool start();
+            bool run(int16_t &centiF);
+            bool isBusy();
+
+            Phase          getPhase                 ();
+            Phase          getLastFailedPhase       ();
+            bool           getLastResumed           ();
+            bool           getLastReused            ();
+            unsigned long  getLastHandshakeMillis   ();
+            unsigned long  getHandshakeCount        ();
+            unsigned long  getResumedCount          ();
+            unsigned long  getFailureCount          ();
+            unsigned long  getLastLatencyMillis     ();
+            const String&  getHost                  ();
+            IPAddress      getAddress               ();
+            float          getLastHumidity          ();
+            CircuitBreaker::State getBreakerState   ();
+            uint8_t        getConsecutiveFailures   ();
+            unsigned long  getRetryInMillis         ();
+            unsigned long  getBreakerTripCount      ();
+
+            static void setResolver(HostResolver *resolver);
+            static const char* getPhaseName(Phase phase);
+            static TempUnit decodeUnit(const char *unit);
+            static bool decodeTemp(JsonVariantConst temp, const char *unit, int16_t &centiF);
+    };
+
+#endif
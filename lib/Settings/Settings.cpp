@@ -39,16 +39,22 @@ bool Settings::factoryDefault() {
 
 /**
  * Used to load the settings from flash memory.
- * After the settings are loaded from flash memory the sentinel value is 
- * checked to ensure the integrity of the loaded data. If the sentinel 
- * value is wrong then the contents of the memory are deemed invalid and
- * the memory is wiped and then a factory default is instead performed.
+ * After the settings are loaded from flash memory the layout version and
+ * sentinel value are checked to ensure the integrity of the loaded data. If
+ * they don't match, or nothing is stored at the size of the current layout,
+ * the memory is checked for settings stored in the layout
+ * used before the layout version was added, and those are carried forward
+ * into the current layout so that a unit keeps its network and admin
+ * settings over an upgrade. If neither is found the contents of the memory
+ * are deemed invalid and the memory is wiped and then a factory default is
+ * instead performed.
  * 
  * @return Returns true if data was loaded from memory and the sentinel 
  * value was valid.
 */
 bool Settings::loadSettings() {
     bool ok = false;
+    bool isStored = false;
     // Setup EEPROM for loading and saving...
     EEPROM.begin(sizeof(NonVolatileSettings));
 
@@ -58,12 +64,12 @@ bool Settings::loadSettings() {
     /* Load from EEPROM if applicable... */
     if (EEPROM.percentUsed() >= 0) { // Something is stored from prior...
         Serial.println(F("\nLoading settings from EEPROM..."));
+        isStored = true;
         EEPROM.get(0, nvSettings);
-        if (strcmp(nvSettings.sentinel, hashNvSettings(nvSettings).c_str()) != 0) { // Memory is corrupt...
-            EEPROM.wipe();
-            factoryDefault();
-            Serial.println("Stored settings footprint invalid, stored settings have been wiped and defaulted!");
-        } else { // Memory seems ok...
+        if (
+            nvSettings.layoutVersion == SETTINGS_LAYOUT_VERSION
+            && strcmp(nvSettings.sentinel, hashNvSettings(nvSettings).c_str()) == 0
+        ) { // Memory seems ok...
             Serial.print(F("Percent of ESP Flash currently used is: "));
             Serial.print(EEPROM.percentUsed());
             Serial.println(F("%"));
@@ -73,6 +79,25 @@ bool Settings::loadSettings() {
     
     EEPROM.end();
 
+    if (!ok) { // Not stored in the current layout...
+        // ESP_EEPROM keeps the size given to begin() with what is stored and finds nothing
+        // stored at any other size, so the older layout is looked for even when nothing was
+        // found above...
+        defaultSettings();
+        if (loadSettingsV1()) { // Stored in the layout before layoutVersion...
+            ok = saveSettings();
+            Serial.println(F("Stored settings were carried forward from an older layout, new settings were defaulted."));
+        } else if (isStored) { // Memory is corrupt...
+            EEPROM.begin(sizeof(NonVolatileSettings));
+            EEPROM.wipe();
+            EEPROM.end();
+            factoryDefault();
+            Serial.println("Stored settings footprint invalid, stored settings have been wiped and defaulted!");
+        }
+    }
+    updateTempSensorSetMask();
+    vSettings.stateVersion++;
+
     return ok;
 }
 
@@ -85,17 +110,42 @@ bool Settings::loadSettings() {
 */
 String Settings::hashNvSettings(NonVolatileSettings nvSet) {
     String content = "";
+    content = content + String(nvSet.layoutVersion);
     content = content + String(nvSet.ssid);
     content = content + String(nvSet.pwd);
     content = content + String(nvSet.adminUser);
     content = content + String(nvSet.adminPwd);
     content = content + String(nvSet.title);
     content = content + String(nvSet.heading);
-    content = content + String(nvSet.tempSensorIp);
-    content = content + String(nvSet.desiredTemp);
-    content = content + String(nvSet.tempPadding);
+    for (uint8_t i = 0U; i < TEMP_SENSOR_MAX_COUNT; i++) {
+        content = content + String(nvSet.tempSensorHost[i]);
+    }
+    content = content + String(nvSet.aggregationPolicy);
+    content = content + String(nvSet.pollFloorSec);
+    content = content + String(nvSet.pollCeilingSec);
+    content = content + String(nvSet.pushKey);
+    content = content + String(nvSet.udpPort);
+    content = content + String(nvSet.sensorConnectTimeoutMs);
+    content = content + String(nvSet.sensorReadTimeoutMs);
+    content = content + String(nvSet.failSafePolicy);
+    content = content + String(nvSet.failSafeAfterSec);
+    content = content + String(nvSet.controlMode);
+    content = content + String(nvSet.pidKp, 6);
+    content = content + String(nvSet.pidKi, 6);
+    content = content + String(nvSet.pidKd, 6);
+    content = content + String(nvSet.pidWindowSec);
+    content = content + String(nvSet.heatMinOnSec);
+    content = content + String(nvSet.heatMinOffSec);
+    content = content + String(nvSet.heatMaxCyclesPerHour);
+    content = content + String(nvSet.coolMinOnSec);
+    content = content + String(nvSet.coolMinOffSec);
+    content = content + String(nvSet.coolMaxCyclesPerHour);
+    content = content + String(nvSet.relayToggleTotal);
+    content = content + String(nvSet.desiredTempCenti);
+    content = content + String(nvSet.tempPaddingCenti);
     content = content + String(nvSet.isHeat);
     content = content + String(nvSet.isAutoControl);
+    content = content + String(nvSet.tlsSessionCacheSize);
 
     MD5Builder builder = MD5Builder();
     builder.begin();
@@ -169,8 +219,14 @@ String Settings::getSsid() {
     return String(nvSettings.ssid);
 }
 
+const char* Settings::getSsidCStr() {
+
+    return nvSettings.ssid;
+}
+
 void Settings::setSsid(const char *ssid) {
-    if (sizeof(ssid) <= sizeof(nvSettings.ssid)) {
+    if (sizeof(ssid) <= sizeof(nvSettings.ssid) && strcmp(nvSettings.ssid, ssid) != 0) { // Value is changing...
+        vSettings.stateVersion++;
         strcpy(nvSettings.ssid, ssid);
     }
 }
@@ -181,8 +237,14 @@ String Settings::getPwd() {
     return String(nvSettings.pwd);
 }
 
+const char* Settings::getPwdCStr() {
+
+    return nvSettings.pwd;
+}
+
 void Settings::setPwd(const char *pwd) {
-    if (sizeof(pwd) <= sizeof(nvSettings.pwd)) {
+    if (sizeof(pwd) <= sizeof(nvSettings.pwd) && strcmp(nvSettings.pwd, pwd) != 0) { // Value is changing...
+        vSettings.stateVersion++;
         strcpy(nvSettings.pwd, pwd);
     }
 }
@@ -193,9 +255,14 @@ String Settings::getAdminUser() {
     return String(nvSettings.adminUser);
 }
 
-void Settings::setAdminUser(const char *user) {
+const char* Settings::getAdminUserCStr() {
+
+    return nvSettings.adminUser;
+}
 
-    if (sizeof(user) <= sizeof(nvSettings.adminUser)) {
+void Settings::setAdminUser(const char *user) {
+    if (sizeof(user) <= sizeof(nvSettings.adminUser) && strcmp(nvSettings.adminUser, user) != 0) { // Value is changing...
+        vSettings.stateVersion++;
         strcpy(nvSettings.adminUser, user);
     }
 }
@@ -206,8 +273,14 @@ String Settings::getAdminPwd() {
     return String(nvSettings.adminPwd);
 }
 
+const char* Settings::getAdminPwdCStr() {
+
+    return nvSettings.adminPwd;
+}
+
 void Settings::setAdminPwd(const char *pwd) {
-    if (sizeof(pwd) <= sizeof(nvSettings.adminPwd)) {
+    if (sizeof(pwd) <= sizeof(nvSettings.adminPwd) && strcmp(nvSettings.adminPwd, pwd) != 0) { // Value is changing...
+        vSettings.stateVersion++;
         strcpy(nvSettings.adminPwd, pwd);
     }
 }
@@ -245,13 +318,16 @@ String Settings::getApGateway() {
 }
 
 
-float Settings::getDesiredTemp() {
+int16_t Settings::getDesiredTempCenti() {
 
-    return nvSettings.desiredTemp;
+    return nvSettings.desiredTempCenti;
 }
 
-void Settings::setDesiredTemp(float temp) {
-    nvSettings.desiredTemp = temp;
+void Settings::setDesiredTempCenti(int16_t centi) {
+    if (nvSettings.desiredTempCenti != centi) { // Value is changing...
+        vSettings.stateVersion++;
+    }
+    nvSettings.desiredTempCenti = centi;
 }
 
 
@@ -260,8 +336,14 @@ String Settings::getHeading() {
     return String(nvSettings.heading);
 }
 
+const char* Settings::getHeadingCStr() {
+
+    return nvSettings.heading;
+}
+
 void Settings::setHeading(const char *heading) {
-    if (sizeof(heading) <= sizeof(nvSettings.heading)) {
+    if (sizeof(heading) <= sizeof(nvSettings.heading) && strcmp(nvSettings.heading, heading) != 0) { // Value is changing...
+        vSettings.stateVersion++;
         strcpy(nvSettings.heading, heading);
     }
 }
@@ -273,29 +355,316 @@ bool Settings::getIsHeat() {
 }
 
 void Settings::setIsHeat(bool isHeat) {
+    if (nvSettings.isHeat != isHeat) { // Value is changing...
+        vSettings.stateVersion++;
+    }
     nvSettings.isHeat = isHeat;
 }
 
 
-String Settings::getTempSensorIp() {
+String Settings::getTempSensorHost() {
+
+    return getTempSensorHost(0U);
+}
+
+void Settings::setTempSensorHost(const char *host) {
+    setTempSensorHost(0U, host);
+}
+
+
+String Settings::getTempSensorHost(uint8_t index) {
+    if (index >= TEMP_SENSOR_MAX_COUNT) { // No such sensor...
+
+        return String();
+    }
+
+    return String(nvSettings.tempSensorHost[index]);
+}
+
+const char* Settings::getTempSensorHostCStr(uint8_t index) {
+    if (index >= TEMP_SENSOR_MAX_COUNT) { // No such sensor...
+
+        return "";
+    }
+
+    return nvSettings.tempSensorHost[index];
+}
+
+void Settings::setTempSensorHost(uint8_t index, const char *host) {
+    if (
+        index < TEMP_SENSOR_MAX_COUNT
+        && strlen(host) < sizeof(nvSettings.tempSensorHost[index])
+        && strcmp(nvSettings.tempSensorHost[index], host) != 0
+    ) { // Value is changing...
+        vSettings.stateVersion++;
+        strcpy(nvSettings.tempSensorHost[index], host);
+    }
+    updateTempSensorSetMask();
+}
+
+
+/**
+ * Used to tell if at least one TempBuddy Sensor has been configured. This is
+ * worked out when sensors are set or loaded so it is cheap to call.
+ * 
+ * @return Returns true if a sensor is set otherwise false as bool.
+*/
+bool Settings::isTempSensorSet() {
 
-    return String(nvSettings.tempSensorIp);
+    return vSettings.tempSensorSetMask != 0U;
 }
 
-void Settings::setTempSensorIp(const char *ip) {
-    if (sizeof(ip) <= sizeof(nvSettings.tempSensorIp)) {
-        strcpy(nvSettings.tempSensorIp, ip);
+/**
+ * Used to tell if the TempBuddy Sensor at the given index has been configured.
+ * 
+ * @param index The index of the sensor as uint8_t.
+ * 
+ * @return Returns true if set otherwise false as bool.
+*/
+bool Settings::isTempSensorSet(uint8_t index) {
+
+    return index < TEMP_SENSOR_MAX_COUNT && (vSettings.tempSensorSetMask & (1U << index)) != 0U;
+}
+
+
+uint8_t Settings::getAggregationPolicy() {
+
+    return nvSettings.aggregationPolicy;
+}
+
+void Settings::setAggregationPolicy(uint8_t policy) {
+    if (nvSettings.aggregationPolicy != policy) { // Value is changing...
+        vSettings.stateVersion++;
     }
+    nvSettings.aggregationPolicy = policy;
 }
 
 
-float Settings::getTempPadding() {
+uint16_t Settings::getPollFloorSec() {
 
-    return nvSettings.tempPadding;
+    return nvSettings.pollFloorSec;
 }
 
-void Settings::setTempPadding(float padding) {
-    nvSettings.tempPadding = padding;
+void Settings::setPollFloorSec(uint16_t seconds) {
+    if (nvSettings.pollFloorSec != seconds) { // Value is changing...
+        vSettings.stateVersion++;
+    }
+    nvSettings.pollFloorSec = seconds;
+}
+
+
+uint16_t Settings::getPollCeilingSec() {
+
+    return nvSettings.pollCeilingSec;
+}
+
+void Settings::setPollCeilingSec(uint16_t seconds) {
+    if (nvSettings.pollCeilingSec != seconds) { // Value is changing...
+        vSettings.stateVersion++;
+    }
+    nvSettings.pollCeilingSec = seconds;
+}
+
+
+String Settings::getPushKey() {
+
+    return String(nvSettings.pushKey);
+}
+
+const char* Settings::getPushKeyCStr() {
+
+    return nvSettings.pushKey;
+}
+
+void Settings::setPushKey(const char *key) {
+    if (strlen(key) < sizeof(nvSettings.pushKey) && strcmp(nvSettings.pushKey, key) != 0) { // Value is changing...
+        vSettings.stateVersion++;
+        strcpy(nvSettings.pushKey, key);
+    }
+}
+
+
+uint16_t Settings::getUdpPort() {
+
+    return nvSettings.udpPort;
+}
+
+void Settings::setUdpPort(uint16_t port) {
+    if (nvSettings.udpPort != port) { // Value is changing...
+        vSettings.stateVersion++;
+    }
+    nvSettings.udpPort = port;
+}
+
+
+uint16_t Settings::getSensorConnectTimeoutMs() {
+
+    return nvSettings.sensorConnectTimeoutMs;
+}
+
+void Settings::setSensorConnectTimeoutMs(uint16_t millis) {
+    if (nvSettings.sensorConnectTimeoutMs != millis) { // Value is changing...
+        vSettings.stateVersion++;
+    }
+    nvSettings.sensorConnectTimeoutMs = millis;
+}
+
+
+uint16_t Settings::getSensorReadTimeoutMs() {
+
+    return nvSettings.sensorReadTimeoutMs;
+}
+
+void Settings::setSensorReadTimeoutMs(uint16_t millis) {
+    if (nvSettings.sensorReadTimeoutMs != millis) { // Value is changing...
+        vSettings.stateVersion++;
+    }
+    nvSettings.sensorReadTimeoutMs = millis;
+}
+
+
+uint8_t Settings::getFailSafePolicy() {
+
+    return nvSettings.failSafePolicy;
+}
+
+void Settings::setFailSafePolicy(uint8_t policy) {
+    if (nvSettings.failSafePolicy != policy) { // Value is changing...
+        vSettings.stateVersion++;
+    }
+    nvSettings.failSafePolicy = policy;
+}
+
+
+uint16_t Settings::getFailSafeAfterSec() {
+
+    return nvSettings.failSafeAfterSec;
+}
+
+void Settings::setFailSafeAfterSec(uint16_t seconds) {
+    if (nvSettings.failSafeAfterSec != seconds) { // Value is changing...
+        vSettings.stateVersion++;
+    }
+    nvSettings.failSafeAfterSec = seconds;
+}
+
+
+uint8_t Settings::getControlMode() {
+
+    return nvSettings.controlMode;
+}
+
+void Settings::setControlMode(uint8_t mode) {
+    if (nvSettings.controlMode != mode) { // Value is changing...
+        vSettings.stateVersion++;
+    }
+    nvSettings.controlMode = mode;
+}
+
+
+float Settings::getPidKp() {
+
+    return nvSettings.pidKp;
+}
+
+float Settings::getPidKi() {
+
+    return nvSettings.pidKi;
+}
+
+float Settings::getPidKd() {
+
+    return nvSettings.pidKd;
+}
+
+void Settings::setPidGains(float kp, float ki, float kd) {
+    if (nvSettings.pidKp != kp || nvSettings.pidKi != ki || nvSettings.pidKd != kd) { // Value is changing...
+        vSettings.stateVersion++;
+    }
+    nvSettings.pidKp = kp;
+    nvSettings.pidKi = ki;
+    nvSettings.pidKd = kd;
+}
+
+
+uint16_t Settings::getPidWindowSec() {
+
+    return nvSettings.pidWindowSec;
+}
+
+void Settings::setPidWindowSec(uint16_t seconds) {
+    if (nvSettings.pidWindowSec != seconds) { // Value is changing...
+        vSettings.stateVersion++;
+    }
+    nvSettings.pidWindowSec = seconds;
+}
+
+
+uint16_t Settings::getMinOnSec(bool isHeat) {
+
+    return (isHeat ? nvSettings.heatMinOnSec : nvSettings.coolMinOnSec);
+}
+
+void Settings::setMinOnSec(bool isHeat, uint16_t seconds) {
+    uint16_t &field = (isHeat ? nvSettings.heatMinOnSec : nvSettings.coolMinOnSec);
+    if (field != seconds) { // Value is changing...
+        vSettings.stateVersion++;
+    }
+    field = seconds;
+}
+
+
+uint16_t Settings::getMinOffSec(bool isHeat) {
+
+    return (isHeat ? nvSettings.heatMinOffSec : nvSettings.coolMinOffSec);
+}
+
+void Settings::setMinOffSec(bool isHeat, uint16_t seconds) {
+    uint16_t &field = (isHeat ? nvSettings.heatMinOffSec : nvSettings.coolMinOffSec);
+    if (field != seconds) { // Value is changing...
+        vSettings.stateVersion++;
+    }
+    field = seconds;
+}
+
+
+uint8_t Settings::getMaxCyclesPerHour(bool isHeat) {
+
+    return (isHeat ? nvSettings.heatMaxCyclesPerHour : nvSettings.coolMaxCyclesPerHour);
+}
+
+void Settings::setMaxCyclesPerHour(bool isHeat, uint8_t cycles) {
+    uint8_t &field = (isHeat ? nvSettings.heatMaxCyclesPerHour : nvSettings.coolMaxCyclesPerHour);
+    if (field != cycles) { // Value is changing...
+        vSettings.stateVersion++;
+    }
+    field = cycles;
+}
+
+
+uint32_t Settings::getRelayToggleTotal() {
+
+    return nvSettings.relayToggleTotal;
+}
+
+void Settings::setRelayToggleTotal(uint32_t total) {
+    if (nvSettings.relayToggleTotal != total) { // Value is changing...
+        vSettings.stateVersion++;
+    }
+    nvSettings.relayToggleTotal = total;
+}
+
+
+int16_t Settings::getTempPaddingCenti() {
+
+    return nvSettings.tempPaddingCenti;
+}
+
+void Settings::setTempPaddingCenti(int16_t centi) {
+    if (nvSettings.tempPaddingCenti != centi) { // Value is changing...
+        vSettings.stateVersion++;
+    }
+    nvSettings.tempPaddingCenti = centi;
 }
 
 
@@ -304,8 +673,14 @@ String Settings::getTitle() {
     return String(nvSettings.title);
 }
 
+const char* Settings::getTitleCStr() {
+
+    return nvSettings.title;
+}
+
 void Settings::setTitle(const char *title) {
-    if (sizeof(title) <= sizeof(nvSettings.title)) {
+    if (sizeof(title) <= sizeof(nvSettings.title) && strcmp(nvSettings.title, title) != 0) { // Value is changing...
+        vSettings.stateVersion++;
         strcpy(nvSettings.title, title);
     }
 }
@@ -317,6 +692,10 @@ bool Settings::getIsControlOn() {
 }
 
 void Settings::setIsControlOn(bool isOn) {
+    if (vSettings.isControlOn != isOn) { // Value is changing...
+        vSettings.stateVersion++;
+        vSettings.liveStateVersion++;
+    }
     vSettings.isControlOn = isOn;
 }
 
@@ -327,21 +706,78 @@ bool Settings::getIsAutoControl() {
 }
 
 void Settings::setIsAutoControl(bool autoOn) {
+    if (nvSettings.isAutoControl != autoOn) { // Value is changing...
+        vSettings.stateVersion++;
+    }
     nvSettings.isAutoControl = autoOn;
     // FYI: No call to settingsChanged() due to not stored in flash.
 }
 
 
-float Settings::getLastKnownTemp() {
+uint8_t Settings::getTlsSessionCacheSize() {
 
-    return vSettings.lastKnownTemp;
+    return nvSettings.tlsSessionCacheSize;
 }
 
-void Settings::setLastKnownTemp(float temp) {
-    vSettings.lastKnownTemp = temp;
+void Settings::setTlsSessionCacheSize(uint8_t size) {
+    if (nvSettings.tlsSessionCacheSize != size) { // Value is changing...
+        vSettings.stateVersion++;
+    }
+    nvSettings.tlsSessionCacheSize = size;
+}
+
+
+int16_t Settings::getLastKnownTempCenti() {
+
+    return vSettings.lastKnownTempCenti;
+}
+
+void Settings::setLastKnownTempCenti(int16_t centi) {
+    if (vSettings.lastKnownTempCenti != centi) { // Value is changing...
+        vSettings.stateVersion++;
+        vSettings.liveStateVersion++;
+    }
+    vSettings.lastKnownTempCenti = centi;
     // FYI: No call to settingsChanged() due to not stored in flash.
 }
 
+
+/**
+ * Used to tell when the live state of the device, meaning the
+ * isControlOn and lastKnownTempCenti values, has changed. The returned
+ * value is bumped each time one of those actually changes value.
+ * 
+ * @return Returns the live state version as unsigned long.
+*/
+unsigned long Settings::getLiveStateVersion() {
+
+    return vSettings.liveStateVersion;
+}
+
+/**
+ * Used to tell that live state shown alongside the settings, such as what
+ * the outlet actually is, has changed without any setter being called. Both
+ * the live state version and the state version are bumped.
+*/
+void Settings::markLiveStateChanged() {
+    vSettings.liveStateVersion++;
+    vSettings.stateVersion++;
+}
+
+
+/**
+ * Used to tell when any of the settings may have changed. The returned
+ * value is bumped each time a setter actually changes a value or settings
+ * are loaded or defaulted, so anything derived from the settings can be
+ * reused for as long as this value stays the same.
+ * 
+ * @return Returns the state version as unsigned long.
+*/
+unsigned long Settings::getStateVersion() {
+
+    return vSettings.stateVersion;
+}
+
 /*
 =================================================================
 Private Functions
@@ -356,19 +792,152 @@ Private Functions
 */
 void Settings::defaultSettings() {
     // Default the settings..
+    nvSettings.layoutVersion = factorySettings.layoutVersion;
     strcpy(nvSettings.ssid, factorySettings.ssid);
     strcpy(nvSettings.pwd, factorySettings.pwd);
     strcpy(nvSettings.adminUser, factorySettings.adminUser);
     strcpy(nvSettings.adminPwd, factorySettings.adminPwd);
     strcpy(nvSettings.title, factorySettings.title);
     strcpy(nvSettings.heading, factorySettings.heading);
-    strcpy(nvSettings.tempSensorIp, factorySettings.tempSensorIp);
-    nvSettings.desiredTemp = factorySettings.desiredTemp;
-    nvSettings.tempPadding = factorySettings.tempPadding;
+    memcpy(nvSettings.tempSensorHost, factorySettings.tempSensorHost, sizeof(nvSettings.tempSensorHost));
+    nvSettings.aggregationPolicy = factorySettings.aggregationPolicy;
+    nvSettings.pollFloorSec = factorySettings.pollFloorSec;
+    nvSettings.pollCeilingSec = factorySettings.pollCeilingSec;
+    strcpy(nvSettings.pushKey, factorySettings.pushKey);
+    nvSettings.udpPort = factorySettings.udpPort;
+    nvSettings.sensorConnectTimeoutMs = factorySettings.sensorConnectTimeoutMs;
+    nvSettings.sensorReadTimeoutMs = factorySettings.sensorReadTimeoutMs;
+    nvSettings.failSafePolicy = factorySettings.failSafePolicy;
+    nvSettings.failSafeAfterSec = factorySettings.failSafeAfterSec;
+    nvSettings.controlMode = factorySettings.controlMode;
+    nvSettings.pidKp = factorySettings.pidKp;
+    nvSettings.pidKi = factorySettings.pidKi;
+    nvSettings.pidKd = factorySettings.pidKd;
+    nvSettings.pidWindowSec = factorySettings.pidWindowSec;
+    nvSettings.heatMinOnSec = factorySettings.heatMinOnSec;
+    nvSettings.heatMinOffSec = factorySettings.heatMinOffSec;
+    nvSettings.heatMaxCyclesPerHour = factorySettings.heatMaxCyclesPerHour;
+    nvSettings.coolMinOnSec = factorySettings.coolMinOnSec;
+    nvSettings.coolMinOffSec = factorySettings.coolMinOffSec;
+    nvSettings.coolMaxCyclesPerHour = factorySettings.coolMaxCyclesPerHour;
+    nvSettings.relayToggleTotal = factorySettings.relayToggleTotal;
+    nvSettings.desiredTempCenti = factorySettings.desiredTempCenti;
+    nvSettings.tempPaddingCenti = factorySettings.tempPaddingCenti;
     nvSettings.isAutoControl = factorySettings.isAutoControl;
     nvSettings.isHeat = factorySettings.isHeat;
+    nvSettings.tlsSessionCacheSize = factorySettings.tlsSessionCacheSize;
     strcpy(nvSettings.sentinel, hashNvSettings(factorySettings).c_str());
 
+    updateTempSensorSetMask();
+
     vSettings.isControlOn = false;
-    vSettings.lastKnownTemp = 0.0;
-}
\ No newline at end of file
+    vSettings.lastKnownTempCenti = 0;
+    vSettings.liveStateVersion++;
+    vSettings.stateVersion++;
+}
+
+/**
+ * #### PRIVATE ####
+ * Works out which TempBuddy Sensors are configured, being set to something
+ * other than blank or 0.0.0.0, for isTempSensorSet.
+*/
+void Settings::updateTempSensorSetMask() {
+    vSettings.tempSensorSetMask = 0U;
+    for (uint8_t i = 0U; i < TEMP_SENSOR_MAX_COUNT; i++) {
+        if (
+            nvSettings.tempSensorHost[i][0] != '\0'
+            && strcmp(nvSettings.tempSensorHost[i], "0.0.0.0") != 0
+        ) {
+            vSettings.tempSensorSetMask |= (1U << i);
+        }
+    }
+}
+
+/**
+ * #### PRIVATE ####
+ * Loads settings stored in the layout used before layoutVersion was added,
+ * checking them against their own sentinel, and carries the ones that still
+ * exist forward into the current settings. Settings that didn't exist then
+ * are left as they are, which is expected to be their defaults.
+ *
+ * @return Returns true if settings in the old layout were found and carried
+ * forward otherwise false as bool.
+*/
+bool Settings::loadSettingsV1() {
+    NonVolatileSettingsV1 oldSettings;
+    bool found = false;
+    EEPROM.begin(sizeof(NonVolatileSettingsV1));
+    if (EEPROM.percentUsed() >= 0) { // Something is stored from prior...
+        EEPROM.get(0, oldSettings);
+        oldSettings.sentinel[sizeof(oldSettings.sentinel) - 1U] = '\0';
+        found = (strcmp(oldSettings.sentinel, hashNvSettingsV1(oldSettings).c_str()) == 0);
+    }
+    EEPROM.end();
+
+    if (!found) { // Not the old layout either...
+
+        return false;
+    }
+
+    copyString(nvSettings.ssid, sizeof(nvSettings.ssid), oldSettings.ssid, sizeof(oldSettings.ssid));
+    copyString(nvSettings.pwd, sizeof(nvSettings.pwd), oldSettings.pwd, sizeof(oldSettings.pwd));
+    copyString(nvSettings.adminUser, sizeof(nvSettings.adminUser), oldSettings.adminUser, sizeof(oldSettings.adminUser));
+    copyString(nvSettings.adminPwd, sizeof(nvSettings.adminPwd), oldSettings.adminPwd, sizeof(oldSettings.adminPwd));
+    copyString(nvSettings.title, sizeof(nvSettings.title), oldSettings.title, sizeof(oldSettings.title));
+    copyString(nvSettings.heading, sizeof(nvSettings.heading), oldSettings.heading, sizeof(oldSettings.heading));
+    copyString(nvSettings.tempSensorHost[0], sizeof(nvSettings.tempSensorHost[0]), oldSettings.tempSensorIp, sizeof(oldSettings.tempSensorIp));
+    nvSettings.desiredTempCenti = CentiTemp::fromFloat(oldSettings.desiredTemp);
+    nvSettings.tempPaddingCenti = CentiTemp::fromFloat(oldSettings.tempPadding);
+    nvSettings.isHeat = oldSettings.isHeat;
+    nvSettings.isAutoControl = oldSettings.isAutoControl;
+
+    return true;
+}
+
+/**
+ * #### PRIVATE ####
+ * Used to provide a hash of the given settings in the layout used before
+ * layoutVersion was added, worked out the same way as it was then.
+ * 
+ * @param nvSet The settings in the old layout as NonVolatileSettingsV1.
+ * 
+ * @return Returns the calculated hash value as String.
+*/
+String Settings::hashNvSettingsV1(const NonVolatileSettingsV1 &nvSet) {
+    String content = "";
+    content = content + String(nvSet.ssid);
+    content = content + String(nvSet.pwd);
+    content = content + String(nvSet.adminUser);
+    content = content + String(nvSet.adminPwd);
+    content = content + String(nvSet.title);
+    content = content + String(nvSet.heading);
+    content = content + String(nvSet.tempSensorIp);
+    content = content + String(nvSet.desiredTemp);
+    content = content + String(nvSet.tempPadding);
+    content = content + String(nvSet.isHeat);
+    content = content + String(nvSet.isAutoControl);
+
+    MD5Builder builder = MD5Builder();
+    builder.begin();
+    builder.add(content);
+    builder.calculate();
+
+    return builder.toString();
+}
+
+/**
+ * #### PRIVATE ####
+ * Copies a string from one fixed size field into another, cutting it short
+ * if it doesn't fit, so the target is always null terminated even when the
+ * source field isn't.
+ *
+ * @param target The field to copy into as char pointer.
+ * @param targetSize The size of the field copied into as size_t.
+ * @param source The field to copy from as char pointer.
+ * @param sourceSize The size of the field copied from as size_t.
+*/
+void Settings::copyString(char *target, size_t targetSize, const char *source, size_t sourceSize) {
+    size_t length = strnlen(source, (sourceSize < targetSize ? sourceSize : targetSize - 1U));
+    memcpy(target, source, length);
+    target[length] = '\0';
+}
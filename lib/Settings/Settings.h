@@ -19,6 +19,73 @@
     #include <core_esp8266_features.h>
     #include <HardwareSerial.h>
     #include <MD5Builder.h>
+    #include <CentiTemp.h>
+
+    #define SETTINGS_LAYOUT_VERSION 2U // Bump when NonVolatileSettings changes and migrate the old layout in loadSettings()
+
+    #ifndef TLS_SESSION_CACHE_DEFAULT_SIZE
+        #define TLS_SESSION_CACHE_DEFAULT_SIZE 5U
+    #endif
+
+    #ifndef POLL_FLOOR_DEFAULT_SEC
+        #define POLL_FLOOR_DEFAULT_SEC 15U
+    #endif
+
+    #ifndef POLL_CEILING_DEFAULT_SEC
+        #define POLL_CEILING_DEFAULT_SEC 300U
+    #endif
+
+    #ifndef SENSOR_CONNECT_TIMEOUT_DEFAULT_MS
+        #define SENSOR_CONNECT_TIMEOUT_DEFAULT_MS 4000U
+    #endif
+
+    #ifndef SENSOR_READ_TIMEOUT_DEFAULT_MS
+        #define SENSOR_READ_TIMEOUT_DEFAULT_MS 4000U
+    #endif
+
+    #ifndef FAIL_SAFE_AFTER_DEFAULT_SEC
+        #define FAIL_SAFE_AFTER_DEFAULT_SEC 900U
+    #endif
+
+    #ifndef PID_WINDOW_DEFAULT_SEC
+        #define PID_WINDOW_DEFAULT_SEC 600U
+    #endif
+
+    #ifndef HEAT_MIN_ON_DEFAULT_SEC
+        #define HEAT_MIN_ON_DEFAULT_SEC 60U
+    #endif
+
+    #ifndef HEAT_MIN_OFF_DEFAULT_SEC
+        #define HEAT_MIN_OFF_DEFAULT_SEC 60U
+    #endif
+
+    #ifndef HEAT_MAX_CYCLES_DEFAULT_PER_HOUR
+        #define HEAT_MAX_CYCLES_DEFAULT_PER_HOUR 12U
+    #endif
+
+    #ifndef COOL_MIN_ON_DEFAULT_SEC
+        #define COOL_MIN_ON_DEFAULT_SEC 180U
+    #endif
+
+    #ifndef COOL_MIN_OFF_DEFAULT_SEC
+        #define COOL_MIN_OFF_DEFAULT_SEC 300U // Lets a compressor's pressures equalize before restarting
+    #endif
+
+    #ifndef COOL_MAX_CYCLES_DEFAULT_PER_HOUR
+        #define COOL_MAX_CYCLES_DEFAULT_PER_HOUR 6U
+    #endif
+
+    #ifndef TEMP_SENSOR_MAX_COUNT
+        #define TEMP_SENSOR_MAX_COUNT 3U // Number of TempBuddy Sensors that can be configured
+    #endif
+
+    #if TEMP_SENSOR_MAX_COUNT > 8
+        #error "TEMP_SENSOR_MAX_COUNT can be at most 8."
+    #endif
+
+    #ifndef TEMP_SENSOR_HOST_SIZE
+        #define TEMP_SENSOR_HOST_SIZE 64U // Longest sensor host name or IP + 1
+    #endif
 
     class Settings {
         private:
@@ -26,41 +93,109 @@
             // Structure used for storing of settings related data and persisted into flash
             // *****************************************************************************
             struct NonVolatileSettings {
+                uint16_t       layoutVersion          ; // SETTINGS_LAYOUT_VERSION the settings were stored with
                 char           ssid             [33]  ; // 32 chars is max size + 1 null
                 char           pwd              [64]  ; // 63 chars is max size + 1 null
                 char           adminUser        [13]  ;
                 char           adminPwd         [13]  ;
                 char           title            [51]  ;
                 char           heading          [51]  ;
-                char           tempSensorIp     [16]  ;
-                float          desiredTemp            ;
-                float          tempPadding            ;
+                char           tempSensorHost   [TEMP_SENSOR_MAX_COUNT][TEMP_SENSOR_HOST_SIZE] ; // First one is the primary
+                uint8_t        aggregationPolicy      ;
+                uint16_t       pollFloorSec           ;
+                uint16_t       pollCeilingSec         ;
+                char           pushKey          [33]  ; // Empty disables /api/push
+                uint16_t       udpPort                ; // Zero disables UDP telemetry
+                uint16_t       sensorConnectTimeoutMs ;
+                uint16_t       sensorReadTimeoutMs    ;
+                uint8_t        failSafePolicy         ;
+                uint16_t       failSafeAfterSec       ; // Age at which the reading is too stale to act on
+                uint8_t        controlMode            ;
+                float          pidKp                  ;
+                float          pidKi                  ;
+                float          pidKd                  ;
+                uint16_t       pidWindowSec           ;
+                uint16_t       heatMinOnSec           ;
+                uint16_t       heatMinOffSec          ;
+                uint8_t        heatMaxCyclesPerHour   ; // Zero is no limit
+                uint16_t       coolMinOnSec           ;
+                uint16_t       coolMinOffSec          ;
+                uint8_t        coolMaxCyclesPerHour   ; // Zero is no limit
+                uint32_t       relayToggleTotal       ; // Only brought up to date now and then
+                int16_t        desiredTempCenti       ; // Temperatures are in hundredths of a degree F
+                int16_t        tempPaddingCenti       ;
                 bool           isHeat                 ;
                 bool           isAutoControl          ;
+                uint8_t        tlsSessionCacheSize    ;
                 char           sentinel         [33]  ; // Holds a 32 MD5 hash + 1
             } nvSettings;
 
             struct NonVolatileSettings factorySettings = {
+                SETTINGS_LAYOUT_VERSION, // <- layoutVersion
                 "SET_ME", // <--------------- ssid
                 "SET_ME", // <--------------- pwd
                 "admin", // <---------------- adminUser
                 "admin", // <---------------- adminPwd
                 "TempBuddy Control", // <---- title
                 "Device Info", // <---------- heading
-                "0.0.0.0", // <-------------- tempBuddyIp
-                72.0, // <------------------- desiredTemp
-                0.5, // <-------------------- tempPadding
+                {"0.0.0.0"}, // <------------ tempSensorHost (others blank)
+                0U, // <--------------------- aggregationPolicy (median)
+                POLL_FLOOR_DEFAULT_SEC, // <- pollFloorSec
+                POLL_CEILING_DEFAULT_SEC, // pollCeilingSec
+                "", // <--------------------- pushKey
+                0U, // <--------------------- udpPort
+                SENSOR_CONNECT_TIMEOUT_DEFAULT_MS, // sensorConnectTimeoutMs
+                SENSOR_READ_TIMEOUT_DEFAULT_MS, // sensorReadTimeoutMs
+                0U, // <--------------------- failSafePolicy (off)
+                FAIL_SAFE_AFTER_DEFAULT_SEC, // failSafeAfterSec
+                0U, // <--------------------- controlMode (hysteresis)
+                0.4, // <-------------------- pidKp
+                0.02, // <------------------- pidKi
+                1.0, // <-------------------- pidKd
+                PID_WINDOW_DEFAULT_SEC, // <- pidWindowSec
+                HEAT_MIN_ON_DEFAULT_SEC, // heatMinOnSec
+                HEAT_MIN_OFF_DEFAULT_SEC, // heatMinOffSec
+                HEAT_MAX_CYCLES_DEFAULT_PER_HOUR, // heatMaxCyclesPerHour
+                COOL_MIN_ON_DEFAULT_SEC, // coolMinOnSec
+                COOL_MIN_OFF_DEFAULT_SEC, // coolMinOffSec
+                COOL_MAX_CYCLES_DEFAULT_PER_HOUR, // coolMaxCyclesPerHour
+                0UL, // <-------------------- relayToggleTotal
+                7200, // <------------------- desiredTempCenti (72.0)
+                50, // <--------------------- tempPaddingCenti (0.5)
                 true, // <------------------- isHeat
                 false, // <------------------ isAutoControl
+                TLS_SESSION_CACHE_DEFAULT_SIZE, // tlsSessionCacheSize
                 "NA" // <-------------------- sentinel
             };
 
+            // *****************************************************************************
+            // Layout the settings were persisted in before layoutVersion was added, kept
+            // so that they can be carried forward rather than wiped
+            // *****************************************************************************
+            struct NonVolatileSettingsV1 {
+                char           ssid             [33]  ;
+                char           pwd              [64]  ;
+                char           adminUser        [13]  ;
+                char           adminPwd         [13]  ;
+                char           title            [51]  ;
+                char           heading          [51]  ;
+                char           tempSensorIp     [16]  ;
+                float          desiredTemp            ;
+                float          tempPadding            ;
+                bool           isHeat                 ;
+                bool           isAutoControl          ;
+                char           sentinel         [33]  ;
+            };
+
             // ******************************************************************
             // Structure used for storing of settings related data NOT persisted
             // ******************************************************************
             struct VolatileSettings {
                 bool           isControlOn            ;
-                float          lastKnownTemp          ;
+                int16_t        lastKnownTempCenti     ;
+                unsigned long  liveStateVersion       ; // Bumped when isControlOn, lastKnownTempCenti or the outlet change
+                unsigned long  stateVersion           ; // Bumped by every setter that changes a value
+                uint8_t        tempSensorSetMask      ; // Bit per configured TempBuddy Sensor
             } vSettings;
 
             // *****************************************************************************
@@ -85,6 +220,10 @@
             
             void defaultSettings();
             String hashNvSettings(NonVolatileSettings nvSet);
+            bool loadSettingsV1();
+            String hashNvSettingsV1(const NonVolatileSettingsV1 &nvSet);
+            static void copyString(char *target, size_t targetSize, const char *source, size_t sourceSize);
+            void updateTempSensorSetMask();
 
 
         public:
@@ -104,31 +243,82 @@
             
             void           setSsid           (const char *ssid)       ;
             String         getSsid           ()                       ;
+            const char*    getSsidCStr       ()                       ;
             void           setPwd            (const char *pwd)        ;
             String         getPwd            ()                       ;
+            const char*    getPwdCStr        ()                       ;
             void           setAdminUser      (const char *user)       ;
             String         getAdminUser      ()                       ;
+            const char*    getAdminUserCStr  ()                       ;
             void           setAdminPwd       (const char *pwd)        ;
             String         getAdminPwd       ()                       ;
+            const char*    getAdminPwdCStr   ()                       ;
         
             void           setTitle          (const char *title)      ;
             String         getTitle          ()                       ;
+            const char*    getTitleCStr      ()                       ;
             void           setHeading        (const char *heading)    ;
             String         getHeading        ()                       ;
-            void           setTempSensorIp    (const char *ip)         ;
-            String         getTempSensorIp    ()                       ;
-            void           setDesiredTemp    (float temp)             ;
-            float          getDesiredTemp    ()                       ;
-            void           setTempPadding    (float padding)          ;
-            float          getTempPadding    ()                       ;
+            const char*    getHeadingCStr    ()                       ;
+            void           setTempSensorHost (const char *host)       ;
+            String         getTempSensorHost ()                       ;
+            void           setTempSensorHost (uint8_t index, const char *host) ;
+            String         getTempSensorHost (uint8_t index)          ;
+            const char*    getTempSensorHostCStr(uint8_t index)     ;
+            bool           isTempSensorSet    ()                       ;
+            bool           isTempSensorSet    (uint8_t index)          ;
+            void           setAggregationPolicy(uint8_t policy)        ;
+            uint8_t        getAggregationPolicy()                      ;
+            void           setPollFloorSec   (uint16_t seconds)       ;
+            uint16_t       getPollFloorSec   ()                       ;
+            void           setPollCeilingSec (uint16_t seconds)       ;
+            uint16_t       getPollCeilingSec ()                       ;
+            void           setPushKey        (const char *key)        ;
+            String         getPushKey        ()                       ;
+            const char*    getPushKeyCStr    ()                       ;
+            void           setUdpPort        (uint16_t port)          ;
+            uint16_t       getUdpPort        ()                       ;
+            void           setSensorConnectTimeoutMs(uint16_t millis) ;
+            uint16_t       getSensorConnectTimeoutMs()                ;
+            void           setSensorReadTimeoutMs(uint16_t millis)    ;
+            uint16_t       getSensorReadTimeoutMs()                   ;
+            void           setFailSafePolicy (uint8_t policy)         ;
+            uint8_t        getFailSafePolicy ()                       ;
+            void           setFailSafeAfterSec(uint16_t seconds)      ;
+            uint16_t       getFailSafeAfterSec()                      ;
+            void           setControlMode    (uint8_t mode)           ;
+            uint8_t        getControlMode    ()                       ;
+            void           setPidGains       (float kp, float ki, float kd) ;
+            float          getPidKp          ()                       ;
+            float          getPidKi          ()                       ;
+            float          getPidKd          ()                       ;
+            void           setPidWindowSec   (uint16_t seconds)       ;
+            uint16_t       getPidWindowSec   ()                       ;
+            void           setMinOnSec       (bool isHeat, uint16_t seconds) ;
+            uint16_t       getMinOnSec       (bool isHeat)            ;
+            void           setMinOffSec      (bool isHeat, uint16_t seconds) ;
+            uint16_t       getMinOffSec      (bool isHeat)            ;
+            void           setMaxCyclesPerHour(bool isHeat, uint8_t cycles) ;
+            uint8_t        getMaxCyclesPerHour(bool isHeat)           ;
+            void           setRelayToggleTotal(uint32_t total)        ;
+            uint32_t       getRelayToggleTotal()                      ;
+            void           setDesiredTempCenti(int16_t centi)         ;
+            int16_t        getDesiredTempCenti()                      ;
+            void           setTempPaddingCenti(int16_t centi)         ;
+            int16_t        getTempPaddingCenti()                      ;
             void           setIsHeat         (bool isHeat)            ;
             bool           getIsHeat         ()                       ;
             void           setIsControlOn    (bool isOn)              ;
             bool           getIsControlOn    ()                       ;
             void           setIsAutoControl  (bool autoOn)            ; 
             bool           getIsAutoControl  ()                       ;
-            void           setLastKnownTemp  (float temp)             ;
-            float          getLastKnownTemp  ()                       ;
+            void           setTlsSessionCacheSize(uint8_t size)       ;
+            uint8_t        getTlsSessionCacheSize()                   ;
+            void           setLastKnownTempCenti(int16_t centi)       ;
+            int16_t        getLastKnownTempCenti()                    ;
+            unsigned long  getLiveStateVersion()                      ;
+            void           markLiveStateChanged()                     ;
+            unsigned long  getStateVersion   ()                       ;
 
             String         getHostname       (String deviceId)        ;
             String         getApSsid         (String deviceId)        ;
@@ -0,0 +1,234 @@
+/*
+  TempAggregator - Combines the readings of several TempBuddy Sensors into one
+  temperature.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include "TempAggregator.h"
+#include <string.h>
+
+// Name of each policy in the same order as Policy...
+static const char *POLICY_NAMES[] = {
+    "median",
+    "mean",
+    "min",
+    "max",
+    "primary"
+};
+
+/**
+ * Used to combine the given readings into one temperature using the given
+ * policy. The used flag of each reading is set to tell if it went into the
+ * result.
+ *
+ * @param readings The readings, with the primary sensor's first, as Reading pointer.
+ * @param count The number of readings as size_t.
+ * @param policy The policy used to combine the readings as Policy.
+ * @param now The current millis() as unsigned long.
+ * @param maxAge The age in milliseconds past which a reading is stale as unsigned long.
+ * @param result Receives the combined temperature in hundredths of a degree F as int16_t reference.
+ *
+ * @return Returns true if there was a usable reading otherwise false as bool.
+*/
+bool TempAggregator::aggregate(Reading *readings, size_t count, Policy policy, unsigned long now, unsigned long maxAge, int16_t &result) {
+    size_t fresh = markFresh(readings, count, now, maxAge);
+    if (fresh == 0U) { // Nothing to go on...
+
+        return false;
+    }
+
+    if (fresh >= 3U) { // Enough readings to tell which are off...
+        int32_t middle = median(readings, count);
+        size_t kept = 0U;
+        for (size_t i = 0U; i < count; i++) {
+            int32_t off = readings[i].centiF - middle;
+            if (readings[i].used && (off < 0 ? -off : off) > TEMP_AGGREGATOR_OUTLIER_CENTI) {
+                readings[i].used = false;
+            }
+            if (readings[i].used) {
+                kept++;
+            }
+        }
+        if (kept == 0U) { // Readings are all over the place, no consensus so keep them all...
+            markFresh(readings, count, now, maxAge);
+        }
+    }
+
+    switch (policy) {
+        case MEAN: {
+            int32_t sum = 0;
+            int32_t used = 0;
+            for (size_t i = 0U; i < count; i++) {
+                if (readings[i].used) {
+                    sum += readings[i].centiF;
+                    used++;
+                }
+            }
+            result = (int16_t) roundedDivide(sum, used);
+            break;
+        }
+        case MIN:
+        case MAX: {
+            bool first = true;
+            for (size_t i = 0U; i < count; i++) {
+                if (!readings[i].used) { // Not in play...
+
+                    continue;
+                }
+                if (first || (policy == MIN ? readings[i].centiF < result : readings[i].centiF > result)) {
+                    result = readings[i].centiF;
+                    first = false;
+                }
+            }
+            break;
+        }
+        case PRIMARY_FAILOVER: {
+            // FYI: Only the first usable sensor, in configured order, is used...
+            bool found = false;
+            for (size_t i = 0U; i < count; i++) {
+                if (readings[i].used && !found) {
+                    result = readings[i].centiF;
+                    found = true;
+                } else {
+                    readings[i].used = false;
+                }
+            }
+            break;
+        }
+        case MEDIAN:
+        default:
+            result = median(readings, count);
+            break;
+    }
+
+    return true;
+}
+
+/**
+ * Used to get the name of the given policy.
+ *
+ * @param policy The policy to get the name of as Policy.
+ *
+ * @return Returns the name as char pointer.
+*/
+const char* TempAggregator::getPolicyName(Policy policy) {
+    if (policy > PRIMARY_FAILOVER) { // Unknown policy...
+
+        return POLICY_NAMES[MEDIAN];
+    }
+
+    return POLICY_NAMES[policy];
+}
+
+/**
+ * Used to find the policy with the given name.
+ *
+ * @param name The name of the policy as char pointer.
+ * @param policy Receives the policy when found as Policy reference.
+ *
+ * @return Returns true if found otherwise false as bool.
+*/
+bool TempAggregator::parsePolicy(const char *name, Policy &policy) {
+    for (uint8_t i = 0U; i < sizeof(POLICY_NAMES) / sizeof(POLICY_NAMES[0]); i++) {
+        if (strcmp(name, POLICY_NAMES[i]) == 0) {
+            policy = static_cast<Policy>(i);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+=================================================================
+Private Functions
+=================================================================
+*/
+
+/**
+ * #### PRIVATE ####
+ * Marks the readings that are recent enough to be used.
+ *
+ * @param readings The readings as Reading pointer.
+ * @param count The number of readings as size_t.
+ * @param now The current millis() as unsigned long.
+ * @param maxAge The age in milliseconds past which a reading is stale as unsigned long.
+ *
+ * @return Returns the number of readings marked as size_t.
+*/
+size_t TempAggregator::markFresh(Reading *readings, size_t count, unsigned long now, unsigned long maxAge) {
+    size_t fresh = 0U;
+    for (size_t i = 0U; i < count; i++) {
+        readings[i].used = readings[i].hasReading && now - readings[i].readAt <= maxAge;
+        if (readings[i].used) {
+            fresh++;
+        }
+    }
+
+    return fresh;
+}
+
+/**
+ * #### PRIVATE ####
+ * Finds the median of the readings that are marked as used. Each reading is
+ * ranked by counting the readings below it, with ties broken by position, so
+ * no sorted copy is needed; there are only ever a handful of sensors.
+ *
+ * @param readings The readings as Reading pointer.
+ * @param count The number of readings as size_t.
+ *
+ * @return Returns the median in hundredths of a degree F as int16_t.
+*/
+int16_t TempAggregator::median(const Reading *readings, size_t count) {
+    size_t used = 0U;
+    for (size_t i = 0U; i < count; i++) {
+        if (readings[i].used) {
+            used++;
+        }
+    }
+
+    int32_t low = 0;
+    int32_t high = 0;
+    for (size_t i = 0U; i < count; i++) {
+        if (!readings[i].used) { // Not in play...
+
+            continue;
+        }
+
+        size_t rank = 0U;
+        for (size_t j = 0U; j < count; j++) {
+            if (
+                readings[j].used
+                && (readings[j].centiF < readings[i].centiF || (readings[j].centiF == readings[i].centiF && j < i))
+            ) {
+                rank++;
+            }
+        }
+        if (rank == (used - 1U) / 2U) {
+            low = readings[i].centiF;
+        }
+        if (rank == used / 2U) {
+            high = readings[i].centiF;
+        }
+    }
+
+    return (int16_t) roundedDivide(low + high, 2);
+}
+
+/**
+ * #### PRIVATE ####
+ * Divides rounding to the nearest, halves away from zero, rather than
+ * truncating.
+ *
+ * @param dividend The number to divide as int32_t.
+ * @param divisor The number to divide by, which must be positive, as int32_t.
+ *
+ * @return Returns the rounded quotient as int32_t.
+*/
+int32_t TempAggregator::roundedDivide(int32_t dividend, int32_t divisor) {
+
+    return (dividend >= 0 ? dividend + divisor / 2 : dividend - divisor / 2) / divisor;
+}
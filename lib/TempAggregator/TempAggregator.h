@@ -0,0 +1,57 @@
+#ifndef TempAggregator_h
+    #define TempAggregator_h
+
+    #include <stddef.h>
+    #include <stdint.h>
+
+    #ifndef TEMP_AGGREGATOR_OUTLIER_CENTI
+        #define TEMP_AGGREGATOR_OUTLIER_CENTI 500 // Readings further than this, in hundredths of a degree F, from the median are left out
+    #endif
+
+    /*
+      CLASS: TempAggregator
+
+      This class combines the readings of several TempBuddy Sensors into the one
+      temperature the device is controlled by, using one of the policies listed in
+      Policy. Before they are combined, readings older than the given age are
+      left out, as the rate sensors are read at changes over time, and
+      when there are at least three readings left, any that are further than
+      TEMP_AGGREGATOR_OUTLIER_CENTI from their median are left out as well. With
+      only two readings there's no telling which one is off so both are kept.
+      Temperatures are in hundredths of a degree F, as CentiTemp keeps them, and
+      combining them is done in integers.
+
+      Written by: Scott Griffis
+      Date: 10-16-2026
+    */
+    class TempAggregator {
+        public:
+            enum Policy : uint8_t {
+                MEDIAN = 0,
+                MEAN,
+                MIN,
+                MAX,
+                PRIMARY_FAILOVER
+            };
+
+            struct Reading {
+                int16_t        centiF                 ; // Last temperature read in hundredths of a degree F
+                unsigned long  readAt                 ; // millis() when it was read
+                bool           hasReading             ; // False until the sensor has been read
+                bool           used                   ; // Set by aggregate() if it went into the result
+            };
+
+        private:
+            TempAggregator();
+
+            static size_t markFresh(Reading *readings, size_t count, unsigned long now, unsigned long maxAge);
+            static int16_t median(const Reading *readings, size_t count);
+            static int32_t roundedDivide(int32_t dividend, int32_t divisor);
+
+        public:
+            static bool aggregate(Reading *readings, size_t count, Policy policy, unsigned long now, unsigned long maxAge, int16_t &result);
+            static const char* getPolicyName(Policy policy);
+            static bool parsePolicy(const char *name, Policy &policy);
+    };
+
+#endif
@@ -0,0 +1,138 @@
+/*
+  TlsSessionCache - Owns the web server's TLS session cache and keeps count of
+  how well it is working.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include "TlsSessionCache.h"
+
+TlsSessionCache *TlsSessionCache::active = nullptr;
+
+/**
+ * #### CLASS CONSTRUCTOR ####
+ * Allows for external instantiation of
+ * the class into an object.
+*/
+TlsSessionCache::TlsSessionCache() {
+    sessions = nullptr;
+    lruVtable = nullptr;
+    size = 0U;
+    stored = 0U;
+    resumedCount = 0UL;
+    fullCount = 0UL;
+    evictionCount = 0UL;
+}
+
+/**
+ * Used to set up the cache. The given size is limited to the range of one
+ * to TLS_SESSION_CACHE_MAX_SIZE. This is intended to be called only once
+ * while the web server is being initialized.
+ *
+ * @param size The number of sessions to cache as uint32_t.
+ *
+ * @return Returns the cache to give to the web server as ServerSessions pointer.
+*/
+BearSSL::ServerSessions *TlsSessionCache::begin(uint32_t size) {
+    if (sessions != nullptr) { // Already begun...
+
+        return sessions;
+    }
+
+    if (size < 1U) {
+        size = 1U;
+    } else if (size > TLS_SESSION_CACHE_MAX_SIZE) {
+        size = TLS_SESSION_CACHE_MAX_SIZE;
+    }
+    this->size = size;
+    sessions = new BearSSL::ServerSessions(storage, size);
+
+    // Place the counting layer in front of BearSSL's LRU cache...
+    const br_ssl_session_cache_class **cache = sessions->getCache();
+    lruVtable = *cache;
+    vtable.context_size = lruVtable->context_size;
+    vtable.save = &TlsSessionCache::save;
+    vtable.load = &TlsSessionCache::load;
+    *cache = &vtable;
+    active = this;
+
+    return sessions;
+}
+
+/**
+ * Used to get the number of sessions the cache holds.
+ *
+ * @return Returns the size of the cache as uint32_t.
+*/
+uint32_t TlsSessionCache::getSize() {
+
+    return size;
+}
+
+/**
+ * Used to get the number of handshakes that resumed a cached session.
+ *
+ * @return Returns the count as unsigned long.
+*/
+unsigned long TlsSessionCache::getResumedCount() {
+
+    return resumedCount;
+}
+
+/**
+ * Used to get the number of handshakes that had to be done in full.
+ *
+ * @return Returns the count as unsigned long.
+*/
+unsigned long TlsSessionCache::getFullCount() {
+
+    return fullCount;
+}
+
+/**
+ * Used to get the number of cached sessions that were evicted to make
+ * room for new ones.
+ *
+ * @return Returns the count as unsigned long.
+*/
+unsigned long TlsSessionCache::getEvictionCount() {
+
+    return evictionCount;
+}
+
+/*
+=================================================================
+Private Functions
+=================================================================
+*/
+
+/**
+ * #### PRIVATE ####
+ * Called by BearSSL after a full handshake to cache the new session.
+*/
+void TlsSessionCache::save(const br_ssl_session_cache_class **ctx, br_ssl_server_context *serverCtx, const br_ssl_session_parameters *params) {
+    TlsSessionCache *cache = active;
+    cache->fullCount++;
+    if (cache->stored < cache->size) { // Still room...
+        cache->stored++;
+    } else { // Oldest session is pushed out...
+        cache->evictionCount++;
+    }
+
+    cache->lruVtable->save(ctx, serverCtx, params);
+}
+
+/**
+ * #### PRIVATE ####
+ * Called by BearSSL when a client offers a session to resume.
+*/
+int TlsSessionCache::load(const br_ssl_session_cache_class **ctx, br_ssl_server_context *serverCtx, br_ssl_session_parameters *params) {
+    TlsSessionCache *cache = active;
+    int found = cache->lruVtable->load(ctx, serverCtx, params);
+    if (found) { // Session will be resumed...
+        cache->resumedCount++;
+    }
+
+    return found;
+}
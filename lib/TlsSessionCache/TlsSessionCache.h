@@ -0,0 +1,54 @@
+#ifndef TlsSessionCache_h
+    #define TlsSessionCache_h
+
+    #include <WiFiClientSecure.h>
+    #include <bearssl/bearssl.h>
+
+    #ifndef TLS_SESSION_CACHE_MAX_SIZE
+        #define TLS_SESSION_CACHE_MAX_SIZE 8U // Static storage is reserved for this many sessions
+    #endif
+
+    /*
+      CLASS: TlsSessionCache
+
+      This class owns the web server's TLS session cache. Storage for the cache is
+      reserved statically for TLS_SESSION_CACHE_MAX_SIZE sessions, of which the size
+      given to begin() is used. The cache keeps count of handshakes that resumed a
+      cached session, handshakes that had to be done in full and sessions that were
+      evicted to make room, so that the cache can be sized from real data.
+
+      Counting is done by placing a thin layer in front of BearSSL's LRU cache, only
+      one instance of this class may be begun.
+
+      Written by: Scott Griffis
+      Date: 10-16-2026
+    */
+    class TlsSessionCache {
+        private:
+            static TlsSessionCache       *active                                    ;
+
+            BearSSL::ServerSession       storage      [TLS_SESSION_CACHE_MAX_SIZE]  ;
+            BearSSL::ServerSessions      *sessions                                  ;
+            br_ssl_session_cache_class   vtable                                     ;
+            const br_ssl_session_cache_class *lruVtable                             ;
+            uint32_t                     size                                       ;
+            uint32_t                     stored                                     ;
+            unsigned long                resumedCount                               ;
+            unsigned long                fullCount                                  ;
+            unsigned long                evictionCount                              ;
+
+            static void save(const br_ssl_session_cache_class **ctx, br_ssl_server_context *serverCtx, const br_ssl_session_parameters *params);
+            static int load(const br_ssl_session_cache_class **ctx, br_ssl_server_context *serverCtx, br_ssl_session_parameters *params);
+
+        public:
+            TlsSessionCache();
+
+            BearSSL::ServerSessions *begin(uint32_t size);
+
+            uint32_t       getSize            ();
+            unsigned long  getResumedCount    ();
+            unsigned long  getFullCount       ();
+            unsigned long  getEvictionCount   ();
+    };
+
+#endif
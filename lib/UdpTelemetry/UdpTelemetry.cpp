@@ -0,0 +1,361 @@
+/*
+  UdpTelemetry - Handles the device's optional UDP channel for sensor readings
+  and status beacons.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include "UdpTelemetry.h"
+
+/**
+ * #### CLASS CONSTRUCTOR ####
+ * Allows for external instantiation of
+ * the class into an object.
+*/
+UdpTelemetry::UdpTelemetry() {
+    port = 0U;
+    keyLength = 0U;
+    bootId = 0U;
+    beaconSequence = 0U;
+    lastBeacon = 0UL;
+    for (uint8_t i = 0U; i < TEMP_SENSOR_MAX_COUNT; i++) {
+        lastBeaconSeq[i] = 0U;
+        lastSequence[i] = 0U;
+        hasSequence[i] = false;
+    }
+    acceptedCount = 0UL;
+    badMacCount = 0UL;
+    replayedCount = 0UL;
+    malformedCount = 0UL;
+    beaconCount = 0UL;
+}
+
+/**
+ * Used to start listening on the given port. Nothing is started if the
+ * port is zero or there is no key, as unauthenticated datagrams are never
+ * accepted or sent.
+ *
+ * @param port The UDP port to listen and send beacons on as uint16_t.
+ * @param key The shared key, which is the push key, as String.
+ * @param bootId The random id of this boot, sent in beacons, as uint32_t.
+ *
+ * @return Returns true if started otherwise false as bool.
+*/
+bool UdpTelemetry::begin(uint16_t port, const String &key, uint32_t bootId) {
+    if (port == 0U || key.isEmpty() || key.length() > sizeof(this->key)) { // Disabled...
+
+        return false;
+    }
+
+    memcpy(this->key, key.c_str(), key.length());
+    keyLength = key.length();
+    this->bootId = bootId;
+    if (!udp.begin(port)) { // Couldn't listen...
+
+        return false;
+    }
+    this->port = port;
+
+    return true;
+}
+
+/**
+ * Used to tell if the channel was started.
+ *
+ * @return Returns true if running otherwise false as bool.
+*/
+bool UdpTelemetry::isRunning() {
+
+    return port != 0U;
+}
+
+/**
+ * Used to handle the datagrams that have arrived, up to
+ * UDP_TELEMETRY_MAX_PACKETS of them. This is intended to be called every
+ * time through the loop.
+ *
+ * @param handler Called with each reading that is accepted as ReadingHandler.
+*/
+void UdpTelemetry::handle(const ReadingHandler &handler) {
+    if (!isRunning()) { // Nothing to do...
+
+        return;
+    }
+
+    uint8_t packet[UDP_TELEMETRY_READING_SIZE];
+    for (uint8_t i = 0U; i < UDP_TELEMETRY_MAX_PACKETS; i++) {
+        int size = udp.parsePacket();
+        if (size <= 0) { // Nothing more...
+
+            break;
+        }
+
+        if (size != UDP_TELEMETRY_READING_SIZE) { // Can't be a reading...
+            udp.flush();
+            malformedCount++;
+
+            continue;
+        }
+        udp.read(packet, sizeof(packet));
+        handlePacket(packet, sizeof(packet), handler);
+    }
+}
+
+/**
+ * Used to tell if it is time to send a beacon.
+ *
+ * @return Returns true if a beacon is due otherwise false as bool.
+*/
+bool UdpTelemetry::isBeaconDue() {
+
+    return isRunning() && (beaconCount == 0UL || millis() - lastBeacon >= UDP_TELEMETRY_BEACON_PERIOD_MS);
+}
+
+/**
+ * Used to broadcast a status beacon on the LAN.
+ *
+ * @param isControlOn True if the outlet is on as bool.
+ * @param isHeat True if controlling heat, false if cool, as bool.
+ * @param isAutoControl True if the outlet is run by temperature as bool.
+ * @param lastKnownTempCenti The last known temperature in hundredths of a degree F as int16_t.
+ * @param desiredTempCenti The desired temperature in hundredths of a degree F as int16_t.
+ * @param tempPaddingCenti The temperature padding in hundredths of a degree F as int16_t.
+ * @param sensorAgeSec Seconds since the last good reading, or ULONG_MAX if never, as unsigned long.
+*/
+void UdpTelemetry::sendBeacon(
+    bool isControlOn,
+    bool isHeat,
+    bool isAutoControl,
+    int16_t lastKnownTempCenti,
+    int16_t desiredTempCenti,
+    int16_t tempPaddingCenti,
+    unsigned long sensorAgeSec
+) {
+    lastBeacon = millis();
+    beaconCount++;
+    beaconSequence++;
+
+    uint8_t packet[UDP_TELEMETRY_BEACON_SIZE] = {};
+    packet[0] = UDP_TELEMETRY_MAGIC_0;
+    packet[1] = UDP_TELEMETRY_MAGIC_1;
+    packet[2] = UDP_TELEMETRY_VERSION;
+    packet[3] = UDP_TELEMETRY_TYPE_BEACON;
+    packet[4] = (isControlOn ? 0x01 : 0x00) | (isHeat ? 0x02 : 0x00) | (isAutoControl ? 0x04 : 0x00);
+    put32(packet + 8, bootId);
+    put32(packet + 12, beaconSequence);
+    put32(packet + 16, millis() / 1000UL);
+    put16(packet + 20, (uint16_t) lastKnownTempCenti);
+    put16(packet + 22, (uint16_t) desiredTempCenti);
+    put16(packet + 24, (uint16_t) tempPaddingCenti);
+    put16(packet + 26, (sensorAgeSec >= 0xFFFFUL ? 0xFFFFU : (uint16_t) sensorAgeSec));
+    sign(packet, UDP_TELEMETRY_BEACON_SIZE - UDP_TELEMETRY_MAC_SIZE, packet + UDP_TELEMETRY_BEACON_SIZE - UDP_TELEMETRY_MAC_SIZE);
+
+    IPAddress broadcast = (WiFi.getMode() & WIFI_STA ? WiFi.broadcastIP() : IPAddress(255, 255, 255, 255));
+    udp.beginPacket(broadcast, port);
+    udp.write(packet, sizeof(packet));
+    udp.endPacket();
+}
+
+/**
+ * Used to get the port the channel is running on.
+ *
+ * @return Returns the port, or zero if not running, as uint16_t.
+*/
+uint16_t UdpTelemetry::getPort() {
+
+    return port;
+}
+
+/**
+ * Used to get the number of readings accepted.
+ *
+ * @return Returns the count as unsigned long.
+*/
+unsigned long UdpTelemetry::getAcceptedCount() {
+
+    return acceptedCount;
+}
+
+/**
+ * Used to get the number of datagrams dropped for a bad HMAC.
+ *
+ * @return Returns the count as unsigned long.
+*/
+unsigned long UdpTelemetry::getBadMacCount() {
+
+    return badMacCount;
+}
+
+/**
+ * Used to get the number of readings dropped for reusing a sequence number
+ * or for not being from a beacon of this boot.
+ *
+ * @return Returns the count as unsigned long.
+*/
+unsigned long UdpTelemetry::getReplayedCount() {
+
+    return replayedCount;
+}
+
+/**
+ * Used to get the number of datagrams dropped for not being a reading.
+ *
+ * @return Returns the count as unsigned long.
+*/
+unsigned long UdpTelemetry::getMalformedCount() {
+
+    return malformedCount;
+}
+
+/**
+ * Used to get the number of beacons sent.
+ *
+ * @return Returns the count as unsigned long.
+*/
+unsigned long UdpTelemetry::getBeaconCount() {
+
+    return beaconCount;
+}
+
+/*
+=================================================================
+Private Functions
+=================================================================
+*/
+
+/**
+ * #### PRIVATE ####
+ * Works out the truncated HMAC-SHA256 of the given data.
+ *
+ * @param data The data to sign as uint8_t pointer.
+ * @param length The length of the data as size_t.
+ * @param mac Receives UDP_TELEMETRY_MAC_SIZE bytes of HMAC as uint8_t pointer.
+*/
+void UdpTelemetry::sign(const uint8_t *data, size_t length, uint8_t *mac) {
+    br_hmac_key_context keyContext;
+    br_hmac_context context;
+    br_hmac_key_init(&keyContext, &br_sha256_vtable, key, keyLength);
+    br_hmac_init(&context, &keyContext, UDP_TELEMETRY_MAC_SIZE);
+    br_hmac_update(&context, data, length);
+    br_hmac_out(&context, mac);
+}
+
+/**
+ * #### PRIVATE ####
+ * Checks the given HMAC against the given data. The comparison takes the
+ * same time no matter where the HMAC differs.
+ *
+ * @param data The data that was signed as uint8_t pointer.
+ * @param length The length of the data as size_t.
+ * @param mac The HMAC to check as uint8_t pointer.
+ *
+ * @return Returns true if the HMAC is good otherwise false as bool.
+*/
+bool UdpTelemetry::verify(const uint8_t *data, size_t length, const uint8_t *mac) {
+    uint8_t expected[UDP_TELEMETRY_MAC_SIZE];
+    sign(data, length, expected);
+
+    uint8_t diff = 0U;
+    for (uint8_t i = 0U; i < UDP_TELEMETRY_MAC_SIZE; i++) {
+        diff |= expected[i] ^ mac[i];
+    }
+
+    return diff == 0U;
+}
+
+/**
+ * #### PRIVATE ####
+ * Handles a datagram that is the size of a reading.
+ *
+ * @param packet The datagram as uint8_t pointer.
+ * @param length The length of the datagram as size_t.
+ * @param handler Called with the reading if it is accepted as ReadingHandler.
+*/
+void UdpTelemetry::handlePacket(const uint8_t *packet, size_t length, const ReadingHandler &handler) {
+    size_t signedLength = length - UDP_TELEMETRY_MAC_SIZE;
+    if (
+        packet[0] != UDP_TELEMETRY_MAGIC_0
+        || packet[1] != UDP_TELEMETRY_MAGIC_1
+        || packet[2] != UDP_TELEMETRY_VERSION
+        || packet[3] != UDP_TELEMETRY_TYPE_READING
+    ) { // Not one of ours...
+        malformedCount++;
+
+        return;
+    }
+    if (!verify(packet, signedLength, packet + signedLength)) { // Not signed with our key...
+        badMacCount++;
+
+        return;
+    }
+
+    uint8_t sensor = packet[4];
+    char unit = (char) packet[5];
+    uint32_t unitBootId = get32(packet + 8);
+    uint32_t beaconSeq = get32(packet + 12);
+    uint32_t sequence = get32(packet + 16);
+    int16_t centiTemp = (int16_t) get16(packet + 20);
+    if (sensor >= TEMP_SENSOR_MAX_COUNT || (unit != 'F' && unit != 'C') || centiTemp == UDP_TELEMETRY_NO_VALUE) { // Nonsense...
+        malformedCount++;
+
+        return;
+    }
+    if (unitBootId != bootId || beaconSeq == 0U || beaconSeq > beaconSequence) { // Not from a beacon of this boot...
+        replayedCount++;
+
+        return;
+    }
+    if (
+        hasSequence[sensor]
+        && (beaconSeq < lastBeaconSeq[sensor] || (beaconSeq == lastBeaconSeq[sensor] && sequence <= lastSequence[sensor]))
+    ) { // Seen it before...
+        replayedCount++;
+
+        return;
+    }
+    lastBeaconSeq[sensor] = beaconSeq;
+    lastSequence[sensor] = sequence;
+    hasSequence[sensor] = true;
+    acceptedCount++;
+
+    handler(sensor, (unit == 'C' ? CentiTemp::celsiusToFahrenheit(centiTemp) : centiTemp));
+}
+
+/**
+ * #### PRIVATE ####
+ * Writes the given value as two little-endian bytes.
+*/
+void UdpTelemetry::put16(uint8_t *at, uint16_t value) {
+    at[0] = (uint8_t) value;
+    at[1] = (uint8_t) (value >> 8);
+}
+
+/**
+ * #### PRIVATE ####
+ * Writes the given value as four little-endian bytes.
+*/
+void UdpTelemetry::put32(uint8_t *at, uint32_t value) {
+    at[0] = (uint8_t) value;
+    at[1] = (uint8_t) (value >> 8);
+    at[2] = (uint8_t) (value >> 16);
+    at[3] = (uint8_t) (value >> 24);
+}
+
+/**
+ * #### PRIVATE ####
+ * Reads two little-endian bytes as a value.
+*/
+uint16_t UdpTelemetry::get16(const uint8_t *at) {
+
+    return (uint16_t) (at[0] | (at[1] << 8));
+}
+
+/**
+ * #### PRIVATE ####
+ * Reads four little-endian bytes as a value.
+*/
+uint32_t UdpTelemetry::get32(const uint8_t *at) {
+
+    return (uint32_t) at[0] | ((uint32_t) at[1] << 8) | ((uint32_t) at[2] << 16) | ((uint32_t) at[3] << 24);
+}
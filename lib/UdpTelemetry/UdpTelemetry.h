@@ -0,0 +1,108 @@
+#ifndef UdpTelemetry_h
+    #define UdpTelemetry_h
+
+    #include <ESP8266WiFi.h>
+    #include <WiFiUdp.h>
+    #include <bearssl/bearssl.h>
+    #include <functional>
+    #include "Settings.h"
+    #include <CentiTemp.h>
+
+    #ifndef UDP_TELEMETRY_BEACON_PERIOD_MS
+        #define UDP_TELEMETRY_BEACON_PERIOD_MS 10000UL
+    #endif
+
+    #ifndef UDP_TELEMETRY_MAX_PACKETS
+        #define UDP_TELEMETRY_MAX_PACKETS 4U // Most datagrams handled per call to handle()
+    #endif
+
+    #define UDP_TELEMETRY_MAGIC_0 'T'
+    #define UDP_TELEMETRY_MAGIC_1 'B'
+    #define UDP_TELEMETRY_VERSION 2U
+    #define UDP_TELEMETRY_TYPE_READING 1U
+    #define UDP_TELEMETRY_TYPE_BEACON 2U
+    #define UDP_TELEMETRY_MAC_SIZE 16U // Truncated HMAC-SHA256
+    #define UDP_TELEMETRY_READING_SIZE (24U + UDP_TELEMETRY_MAC_SIZE)
+    #define UDP_TELEMETRY_BEACON_SIZE (28U + UDP_TELEMETRY_MAC_SIZE)
+    #define UDP_TELEMETRY_NO_VALUE 0x7FFF // Sent in place of a missing value
+
+    /*
+      CLASS: UdpTelemetry
+
+      This class handles the device's optional UDP channel. Sensors can send their
+      readings to it as small fixed-layout datagrams, which is far cheaper than an
+      HTTPS request, and it broadcasts a status beacon on the LAN so that monitors
+      can follow the device without opening TLS sessions to it.
+
+      Every datagram, both ways, ends with an HMAC-SHA256 of the rest of it keyed
+      with the push key and cut to UDP_TELEMETRY_MAC_SIZE bytes. Beacons carry a
+      random id of this boot and a sequence number that counts up within it, and
+      a sensor copies both from the latest beacon it has heard into each reading
+      along with its own sequence number. A reading is only accepted if it names
+      this boot, names a beacon that has been sent, and its beacon and own
+      sequence numbers, taken in that order, are above the last ones accepted from
+      that sensor. So a captured reading can't be replayed, not even after this
+      device reboots, and a sensor that reboots and starts counting again from one
+      is accepted as soon as it has heard a newer beacon. All values are
+      little-endian and temperatures are in hundredths of a degree. See the README
+      for the layouts.
+
+      Written by: Scott Griffis
+      Date: 10-16-2026
+    */
+    class UdpTelemetry {
+        public:
+            typedef std::function<void(uint8_t sensor, int16_t centiF)> ReadingHandler;
+
+        private:
+            WiFiUDP                    udp                                      ;
+            uint16_t                   port                                     ;
+            uint8_t                    key            [32]                      ;
+            size_t                     keyLength                                ;
+            uint32_t                   bootId                                   ;
+            uint32_t                   beaconSequence                           ;
+            unsigned long              lastBeacon                               ;
+            uint32_t                   lastBeaconSeq  [TEMP_SENSOR_MAX_COUNT]   ;
+            uint32_t                   lastSequence   [TEMP_SENSOR_MAX_COUNT]   ;
+            bool                       hasSequence    [TEMP_SENSOR_MAX_COUNT]   ;
+            unsigned long              acceptedCount                            ;
+            unsigned long              badMacCount                              ;
+            unsigned long              replayedCount                            ;
+            unsigned long              malformedCount                           ;
+            unsigned long              beaconCount                              ;
+
+            void sign(const uint8_t *data, size_t length, uint8_t *mac);
+            bool verify(const uint8_t *data, size_t length, const uint8_t *mac);
+            void handlePacket(const uint8_t *packet, size_t length, const ReadingHandler &handler);
+
+            static void put16(uint8_t *at, uint16_t value);
+            static void put32(uint8_t *at, uint32_t value);
+            static uint16_t get16(const uint8_t *at);
+            static uint32_t get32(const uint8_t *at);
+
+        public:
+            UdpTelemetry();
+
+            bool begin(uint16_t port, const String &key, uint32_t bootId);
+            bool isRunning();
+            void handle(const ReadingHandler &handler);
+            bool isBeaconDue();
+            void sendBeacon(
+                bool isControlOn,
+                bool isHeat,
+                bool isAutoControl,
+                int16_t lastKnownTempCenti,
+                int16_t desiredTempCenti,
+                int16_t tempPaddingCenti,
+                unsigned long sensorAgeSec
+            );
+
+            uint16_t       getPort              ();
+            unsigned long  getAcceptedCount     ();
+            unsigned long  getBadMacCount       ();
+            unsigned long  getReplayedCount     ();
+            unsigned long  getMalformedCount    ();
+            unsigned long  getBeaconCount       ();
+    };
+
+#endif
@@ -0,0 +1,106 @@
+"""
+  build_assets.py - PlatformIO pre-build script that turns the static assets in
+  the assets directory into src/StaticAssets.h. Each asset is minified, gzipped
+  and written out as a PROGMEM byte array along with its length and an ETag
+  derived from its content, so the device can serve it as is with
+  'Content-Encoding: gzip' and a long cache lifetime.
+
+  The header is only rewritten when its content would change, so this doesn't
+  cause needless rebuilds. It can also be run by hand: python scripts/build_assets.py
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+"""
+
+import gzip
+import hashlib
+import os
+import re
+
+try:
+    Import("env")  # noqa: F821 - Provided by PlatformIO
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+ASSETS_DIR = os.path.join(PROJECT_DIR, "assets")
+OUTPUT_FILE = os.path.join(PROJECT_DIR, "src", "StaticAssets.h")
+
+# (Asset file name, C identifier prefix, minifier name)
+ASSETS = [
+    ("style.css", "STYLE_CSS", "css"),
+]
+
+
+def minify_css(text):
+    """Strips comments and needless whitespace from the given CSS."""
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"\s+", " ", text)
+    text = re.sub(r"\s*([{}:;,>])\s*", r"\1", text)
+    text = text.replace(";}", "}")
+
+    return text.strip()
+
+
+MINIFIERS = {
+    "css": minify_css,
+}
+
+
+def to_c_array(data):
+    """Formats the given bytes as the body of a C array, 16 bytes per line."""
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("        " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+
+    return "\n".join(lines)
+
+
+def build_header():
+    """Builds the content of StaticAssets.h from the assets."""
+    out = [
+        "#ifndef StaticAssets_h",
+        "    #define StaticAssets_h",
+        "",
+        "    #include <pgmspace.h>",
+        "    #include <stdint.h>",
+        "",
+        "    /*",
+        "     * GENERATED FILE - DO NOT EDIT!!!",
+        "     * This file is generated from the assets directory by scripts/build_assets.py",
+        "     * during the build. Make changes to the assets themselves instead.",
+        "    */",
+    ]
+    for file_name, name, minifier in ASSETS:
+        with open(os.path.join(ASSETS_DIR, file_name), "r", encoding="utf-8") as f:
+            text = MINIFIERS[minifier](f.read())
+        data = gzip.compress(text.encode("utf-8"), compresslevel=9, mtime=0)
+        version = hashlib.sha1(text.encode("utf-8")).hexdigest()[:12]
+        out += [
+            "",
+            "    // %s: %d bytes minified, %d bytes gzipped" % (file_name, len(text), len(data)),
+            "    #define %s_VERSION \"%s\"" % (name, version),
+            "    #define %s_ETAG \"\\\"%s\\\"\"" % (name, version),
+            "    const uint32_t %s_GZ_LENGTH = %dU;" % (name, len(data)),
+            "    const uint8_t PROGMEM %s_GZ[] = {" % name,
+            to_c_array(data),
+            "    };",
+        ]
+    out += ["", "#endif", ""]
+
+    return "\n".join(out)
+
+
+def main():
+    content = build_header()
+    existing = None
+    if os.path.exists(OUTPUT_FILE):
+        with open(OUTPUT_FILE, "r", encoding="utf-8") as f:
+            existing = f.read()
+    if content != existing:
+        with open(OUTPUT_FILE, "w", encoding="utf-8") as f:
+            f.write(content)
+        print("build_assets.py: Updated %s" % OUTPUT_FILE)
+
+
+main()
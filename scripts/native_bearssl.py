@@ -0,0 +1,33 @@
+"""
+  native_bearssl.py - PlatformIO pre-build script for the native environment
+  that links the host tests with BearSSL when it can be found, for
+  test_bench_tls_handshake. Without it that benchmark is ignored and every
+  other test runs as usual.
+
+  BearSSL is looked for in the directory named by the BEARSSL_DIR environment
+  variable, a BearSSL source tree built with `make` (so inc/bearssl.h and
+  build/libbearssl.a), and then among the system headers, where a package
+  such as Debian's libbearssl-dev puts it.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+"""
+
+import os
+
+Import("env")  # noqa: F821 - Provided by PlatformIO
+
+SYSTEM_INCLUDE_DIRS = ["/usr/include", "/usr/local/include", "/opt/homebrew/include"]
+
+bearssl_dir = os.environ.get("BEARSSL_DIR")
+if bearssl_dir and os.path.isfile(os.path.join(bearssl_dir, "inc", "bearssl.h")):
+    env.Append(  # noqa: F821
+        CPPPATH=[os.path.join(bearssl_dir, "inc")],
+        LIBPATH=[os.path.join(bearssl_dir, "build")],
+        LIBS=["bearssl"],
+        CPPDEFINES=["NATIVE_HAS_BEARSSL"],
+    )
+elif any(os.path.isfile(os.path.join(d, "bearssl.h")) for d in SYSTEM_INCLUDE_DIRS):
+    env.Append(LIBS=["bearssl"], CPPDEFINES=["NATIVE_HAS_BEARSSL"])  # noqa: F821
+else:
+    print("BearSSL wasn't found for the host, the TLS handshake benchmark will be ignored.")
@@ -0,0 +1,172 @@
+"""
+  push_load.py - Host-side load tester for the unit's Push API. It stands in
+  for any number of TempBuddy Sensors, POSTing readings to /api/push with the
+  Sensor Push Key as the bearer token at a set rate and concurrency, then
+  reports how many were accepted, why any failed, and the latency:
+
+    python scripts/push_load.py --host <unit-ip> --key <push-key>
+        [--rate 2] [--concurrency 2] [--count 100] [--temp 71.6] [--unit F]
+        [--sensor 0] [--keep-alive] [--cafile ca_cer.pem]
+
+  Each request opens its own TLS connection, as a sensor does, unless
+  --keep-alive is given. The unit's cert isn't checked unless --cafile names
+  the CA that signed it.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+"""
+
+import argparse
+import http.client
+import json
+import ssl
+import threading
+import time
+
+
+class Results:
+    """Collects the outcome of every request, safe to share between workers."""
+
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.latencies = []
+        self.failures = {}
+
+    def add_success(self, latency):
+        with self.lock:
+            self.latencies.append(latency)
+
+    def add_failure(self, reason):
+        with self.lock:
+            self.failures[reason] = self.failures.get(reason, 0) + 1
+
+
+class Schedule:
+    """Hands out request numbers, each at its time when a rate is set."""
+
+    def __init__(self, count, rate):
+        self.lock = threading.Lock()
+        self.count = count
+        self.rate = rate
+        self.next = 0
+        self.start = time.monotonic()
+
+    def take(self):
+        """Waits for the next request's turn, returning None when all are taken."""
+        with self.lock:
+            if self.next >= self.count:
+                return None
+            number = self.next
+            self.next += 1
+        if self.rate > 0:
+            delay = self.start + number / self.rate - time.monotonic()
+            if delay > 0:
+                time.sleep(delay)
+
+        return number
+
+
+def make_context(args):
+    """Makes the TLS context, checking the unit's cert only if a CA is given."""
+    if args.cafile:
+        context = ssl.create_default_context(cafile=args.cafile)
+        context.check_hostname = False
+    else:
+        context = ssl._create_unverified_context()
+
+    return context
+
+
+def worker(args, context, schedule, results):
+    """Sends requests until the schedule runs out."""
+    body = {"temp": args.temp, "temp_unit": args.unit}
+    if args.sensor is not None:
+        body["sensor"] = args.sensor
+    body = json.dumps(body, separators=(",", ":"))
+    headers = {
+        "Authorization": "Bearer " + args.key,
+        "Content-Type": "application/json",
+        "Connection": "keep-alive" if args.keep_alive else "close",
+    }
+
+    connection = None
+    while schedule.take() is not None:
+        start = time.monotonic()
+        try:
+            if connection is None:
+                connection = http.client.HTTPSConnection(args.host, args.port, timeout=args.timeout, context=context)
+            connection.request("POST", "/api/push", body=body, headers=headers)
+            response = connection.getresponse()
+            response.read()
+            latency = time.monotonic() - start
+            if response.status == 204:
+                results.add_success(latency)
+            else:
+                results.add_failure("HTTP %d" % response.status)
+            if not args.keep_alive or response.will_close:
+                connection.close()
+                connection = None
+        except (OSError, http.client.HTTPException) as error:
+            results.add_failure(type(error).__name__)
+            if connection is not None:
+                connection.close()
+                connection = None
+
+    if connection is not None:
+        connection.close()
+
+
+def percentile(ordered, fraction):
+    """Gives the value at the given fraction of the ordered values."""
+    return ordered[min(len(ordered) - 1, int(fraction * len(ordered)))]
+
+
+def report(args, results, elapsed):
+    """Prints what the run came to."""
+    succeeded = len(results.latencies)
+    failed = sum(results.failures.values())
+    print("%d requests in %.1f s, %.2f per second, concurrency %d" % (
+        succeeded + failed, elapsed, (succeeded + failed) / elapsed if elapsed > 0 else 0.0, args.concurrency
+    ))
+    print("accepted: %d, failed: %d" % (succeeded, failed))
+    for reason, count in sorted(results.failures.items()):
+        print("  %s: %d" % (reason, count))
+    if succeeded:
+        ordered = sorted(x * 1000.0 for x in results.latencies)
+        print("latency ms: min %.0f, p50 %.0f, p90 %.0f, p99 %.0f, max %.0f" % (
+            ordered[0], percentile(ordered, 0.5), percentile(ordered, 0.9), percentile(ordered, 0.99), ordered[-1]
+        ))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Load tests a unit's Push API.")
+    parser.add_argument("--host", required=True, help="The unit's address")
+    parser.add_argument("--port", type=int, default=443)
+    parser.add_argument("--key", required=True, help="The unit's Sensor Push Key")
+    parser.add_argument("--rate", type=float, default=2.0, help="Requests per second over all workers, 0 for flat out")
+    parser.add_argument("--concurrency", type=int, default=2, help="Requests in flight at once")
+    parser.add_argument("--count", type=int, default=100, help="Requests to send")
+    parser.add_argument("--temp", type=float, default=70.0)
+    parser.add_argument("--unit", choices=["F", "C"], default="F")
+    parser.add_argument("--sensor", type=int, help="0 based sensor index to name in the body")
+    parser.add_argument("--keep-alive", action="store_true", help="Reuse each worker's connection")
+    parser.add_argument("--timeout", type=float, default=10.0, help="Seconds before a request fails")
+    parser.add_argument("--cafile", help="CA cert to check the unit's cert against")
+    args = parser.parse_args()
+
+    context = make_context(args)
+    schedule = Schedule(args.count, args.rate)
+    results = Results()
+    workers = [
+        threading.Thread(target=worker, args=(args, context, schedule, results))
+        for _ in range(max(1, args.concurrency))
+    ]
+    for thread in workers:
+        thread.start()
+    for thread in workers:
+        thread.join()
+    report(args, results, time.monotonic() - schedule.start)
+
+
+if __name__ == "__main__":
+    main()
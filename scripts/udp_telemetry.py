@@ -0,0 +1,169 @@
+"""
+  udp_telemetry.py - Host-side harness for the unit's UDP telemetry channel. It
+  can follow the status beacons a unit broadcasts, or act as a sensor and send
+  signed readings to a unit, the same way a real sensor should:
+
+    python scripts/udp_telemetry.py listen --key <push-key> --port <port>
+    python scripts/udp_telemetry.py send --key <push-key> --port <port> --temp 71.6
+        [--unit F] [--sensor 0] [--count 1] [--interval 5] [--host <unit-ip>]
+
+  As a sensor it sends nothing until it hears a beacon, copies the boot id and
+  sequence number of the latest beacon it has heard into each reading, and
+  counts its own sequence number up from one each time it is started. See the
+  UDP Telemetry section of the README for the layouts.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+"""
+
+import argparse
+import hashlib
+import hmac
+import socket
+import struct
+import time
+
+MAGIC = b"TB"
+VERSION = 2
+TYPE_READING = 1
+TYPE_BEACON = 2
+MAC_SIZE = 16
+READING_SIZE = 24 + MAC_SIZE
+BEACON_SIZE = 28 + MAC_SIZE
+NO_VALUE = 0x7FFF
+
+# Everything but the MAC, little-endian
+READING_FORMAT = "<2sBBBcHIIIhh"
+BEACON_FORMAT = "<2sBBB3xIIIhhhH"
+
+
+def sign(key, data):
+    """Works out the truncated HMAC-SHA256 of the given data."""
+    return hmac.new(key, data, hashlib.sha256).digest()[:MAC_SIZE]
+
+
+def decode_beacon(key, packet):
+    """Decodes a beacon, returning None if it isn't a good one."""
+    if len(packet) != BEACON_SIZE:
+        return None
+    body, mac = packet[:-MAC_SIZE], packet[-MAC_SIZE:]
+    if not hmac.compare_digest(sign(key, body), mac):
+        return None
+    magic, version, kind, flags, boot_id, sequence, uptime, last_known, desired, padding, age = struct.unpack(
+        BEACON_FORMAT, body
+    )
+    if magic != MAGIC or version != VERSION or kind != TYPE_BEACON:
+        return None
+
+    return {
+        "boot_id": boot_id,
+        "sequence": sequence,
+        "uptime_sec": uptime,
+        "is_control_on": bool(flags & 0x01),
+        "is_heat": bool(flags & 0x02),
+        "is_auto_control": bool(flags & 0x04),
+        "last_known_temp": last_known / 100.0,
+        "desired_temp": desired / 100.0,
+        "temp_padding": padding / 100.0,
+        "sensor_age_sec": None if age == 0xFFFF else age,
+    }
+
+
+def encode_reading(key, sensor, unit, boot_id, beacon_sequence, sequence, temp):
+    """Makes a signed reading."""
+    body = struct.pack(
+        READING_FORMAT,
+        MAGIC,
+        VERSION,
+        TYPE_READING,
+        sensor,
+        unit.encode(),
+        0,
+        boot_id,
+        beacon_sequence,
+        sequence,
+        int(round(temp * 100)),
+        NO_VALUE,
+    )
+
+    return body + sign(key, body)
+
+
+def open_socket(port):
+    """Opens a socket on the telemetry port that hears the unit's broadcasts."""
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_BROADCAST, 1)
+    sock.bind(("", port))
+
+    return sock
+
+
+def listen(args):
+    """Prints each good beacon heard."""
+    sock = open_socket(args.port)
+    while True:
+        packet, sender = sock.recvfrom(1500)
+        beacon = decode_beacon(args.key, packet)
+        if beacon is not None:
+            print(sender[0], beacon, flush=True)
+
+
+def send(args):
+    """Sends readings to the unit whose beacons are heard, as a sensor would."""
+    sock = open_socket(args.port)
+    unit_address = None
+    boot_id = None
+    beacon_sequence = 0
+    sequence = 0
+    sent = 0
+    next_send = 0.0
+    while sent < args.count:
+        # Follow the latest beacon, dropping any older than the one we have...
+        sock.settimeout(max(0.0, next_send - time.monotonic()) if boot_id is not None else None)
+        try:
+            packet, sender = sock.recvfrom(1500)
+            beacon = decode_beacon(args.key, packet)
+            if beacon is not None and (args.host is None or sender[0] == args.host):
+                if beacon["boot_id"] != boot_id or beacon["sequence"] > beacon_sequence:
+                    unit_address = sender[0]
+                    boot_id = beacon["boot_id"]
+                    beacon_sequence = beacon["sequence"]
+            continue
+        except socket.timeout:
+            pass
+
+        sequence += 1
+        sock.sendto(
+            encode_reading(args.key, args.sensor, args.unit, boot_id, beacon_sequence, sequence, args.temp),
+            (unit_address, args.port),
+        )
+        print("sent %s%s as sensor %d to %s, beacon %d, sequence %d" % (
+            args.temp, args.unit, args.sensor, unit_address, beacon_sequence, sequence
+        ), flush=True)
+        sent += 1
+        next_send = time.monotonic() + args.interval
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Talks to a unit's UDP telemetry channel.")
+    parser.add_argument("mode", choices=["listen", "send"])
+    parser.add_argument("--key", required=True, help="The unit's Sensor Push Key")
+    parser.add_argument("--port", type=int, required=True, help="The unit's Telemetry UDP Port")
+    parser.add_argument("--host", help="Only follow the unit at this address")
+    parser.add_argument("--sensor", type=int, default=0, help="0 based sensor index")
+    parser.add_argument("--temp", type=float, default=70.0)
+    parser.add_argument("--unit", choices=["F", "C"], default="F")
+    parser.add_argument("--count", type=int, default=1, help="Readings to send")
+    parser.add_argument("--interval", type=float, default=5.0, help="Seconds between readings")
+    args = parser.parse_args()
+    args.key = args.key.encode()
+
+    if args.mode == "listen":
+        listen(args)
+    else:
+        send(args)
+
+
+if __name__ == "__main__":
+    main()
@@ -3,31 +3,24 @@
 
     #include <WString.h>
     #include <pgmspace.h>
+    #include "HtmlTemplate.h"
+    #include "StaticAssets.h"
 
     /**
      * This is the HTML content that is common to ALL Pages which can be
      * displayed by this device's web service. The page's style is primarily 
-     * controlled here and the HTTP Headers are inserted by this template. 
+     * controlled by assets/style.css, which is served separately from /style.css,
+     * and the HTTP Headers are inserted by this template. 
      * The content of this template is placed into the template by replacing the
      * ${content} place-holder.
     */
-      const char PROGMEM HTML_PAGE_TEMPLATE[] = {""
+      constexpr char PROGMEM HTML_PAGE_TEMPLATE[] = {""
         "<!DOCTYPE HTML> "
         "<html lang=\"en\"> "
             "<head> "
                 "<title>${title}</title> "
                 "${metainsert} "
-                "<style> "
-                    "body { background-color: #FFFFFF; color: #000000; } "
-                    "h1 { text-align: center; background-color: #5878B0; color: #FFFFFF; border: 3px; border-radius: 15px; } "
-                    "h2 { text-align: center; background-color: #58ADB0; color: #FFFFFF; border: 3px; } "
-                    "#successful { text-align: center; color: #02CF39; } "
-                    "#failed { text-align: center; color: #CF0202; } "
-                    "#wrapper { background-color: #E6EFFF; padding: 20px; margin-left: auto; margin-right: auto; max-width: 700px; box-shadow: 3px 3px 3px #333; } "
-                    "#info { font-size: 25px; font-weight: bold; line-height: 150%; } "
-                    "button { background-color: #5878B0; color: white; font-size: 16px; padding: 10px 24px; border-radius: 12px; border: 2px solid black; transition-duration: 0.4s; } "
-                    "button:hover { background-color: white; color: black; } "
-                "</style> "
+                "<link rel=\"stylesheet\" href=\"/style.css?v=" STYLE_CSS_VERSION "\"> "
             "</head> "
             ""
             "<div id=\"wrapper\"> "
@@ -36,6 +29,7 @@
             "</div> "
         "</html>"}
     ;
+    constexpr auto PROGMEM HTML_PAGE_TEMPLATE_INDEX = HTML_TEMPLATE_INDEX(HTML_PAGE_TEMPLATE);
 
     /**
      * This is the HTML content of the Info Page.
@@ -43,10 +37,10 @@
      * added just prior to sending to client, as well as for adding in the
      * appropriate control section to the page.
     */
-    const char PROGMEM INFO_PAGE[] = {""
+    constexpr char PROGMEM INFO_PAGE[] = {""
         "<p>"
             "<table>"
-                "<tr><td>Temp Sensor IP:</td><td>${tempsensorip}</td></tr>"
+                "<tr><td>Temp Sensor:</td><td>${tempsensorip}</td></tr>"
                 "<tr><td>Last known temp:</td><td>${lastknowntemp}&deg;F</td></tr>"
                 "<tr><td>Control Type:</td><td>${controltype}</td></tr>"
                 "<tr><td>Auto Ctrl Enabled:</td><td>${autocontrolenabled}</td></tr>"
@@ -54,13 +48,14 @@
             "</table>"
         "</p>"}
     ;
+    constexpr auto PROGMEM INFO_PAGE_INDEX = HTML_TEMPLATE_INDEX(INFO_PAGE);
 
     /**
      * This is the HTML content of the Admin/Settings Page.
      * This HTML has replaceable place-holders for dynamic informaton to be
      * added just prior to sending to client.
     */
-    const char PROGMEM ADMIN_SETTINGS_PAGE[] = {""  
+    constexpr char PROGMEM ADMIN_SETTINGS_PAGE[] = {""  
         "<form name=\"settings\" method=\"post\" id=\"settings\" action=\"admin\"> "
             "<input type=\"hidden\" id=\"source\" name=\"source\" value=\"settings\">"
             "<h2>WiFi</h2> "
@@ -76,7 +71,13 @@
             "</table>"
             "<h2>Admin</h2> "
             "<table>"
-                "<tr><td>TempBuddy Sensor IP:</td><td><input maxlength=\"14\" type=\"text\" value=\"${sensorip}\" name=\"sensorip\" id=\"sensorip\"></td></tr> "
+                "<tr><td>TempBuddy Sensor:</td><td><input maxlength=\"63\" type=\"text\" list=\"foundsensors\" value=\"${sensorip}\" name=\"sensorip\" id=\"sensorip\"> (IP or host name)</td></tr> "
+                "${extrasensors}"
+                "<tr><td>Found Sensors:</td><td>${foundsensors} <a href='/admin?action=browse'>Browse</a></td></tr> "
+                "<tr><td>Sensor Aggregation:</td><td><select name=\"aggregation\" id=\"aggregation\">${aggregationoptions}</select></td></tr> "
+                "<tr><td>Sensor Poll Interval:</td><td><input type=\"number\" id=\"pollfloor\" name=\"pollfloor\" min=\"5\" max=\"3600\" step=\"1\" value=\"${pollfloor}\"> to <input type=\"number\" id=\"pollceiling\" name=\"pollceiling\" min=\"5\" max=\"3600\" step=\"1\" value=\"${pollceiling}\"> (Seconds)</td></tr> "
+                "<tr><td>Sensor Timeouts:</td><td>Connect <input type=\"number\" id=\"connecttimeout\" name=\"connecttimeout\" min=\"500\" max=\"30000\" step=\"100\" value=\"${connecttimeout}\"> Read <input type=\"number\" id=\"readtimeout\" name=\"readtimeout\" min=\"500\" max=\"30000\" step=\"100\" value=\"${readtimeout}\"> (Milliseconds)</td></tr> "
+                "<tr><td>Stale Reading Fail-Safe:</td><td>Outlet <select name=\"failsafe\" id=\"failsafe\">${failsafeoptions}</select> after <input type=\"number\" id=\"failsafeafter\" name=\"failsafeafter\" min=\"0\" max=\"65535\" step=\"1\" value=\"${failsafeafter}\"> (Seconds, 0 disables)</td></tr> "
                 "<tr><td>Auto Control:</td></tr> "
                 "<tr>"
                     "<td>"
@@ -99,13 +100,21 @@
                 "</tr>"
                 "<tr><td>Desired Temp:</td><td><input type=\"number\" id=\"desiredtemp\" name=\"desiredtemp\" min=\"-100.0\" max=\"100.0\" step=\".1\" value=\"${desiredtemp}\"> (&deg;F)</td></tr> "
                 "<tr><td>Temp Padding:</td><td><input type=\"number\" id=\"temppadding\" name=\"temppadding\" min=\"0.0\" max=\"100.0\" step=\".1\" value=\"${temppadding}\"> (&deg;F)</td></tr> "
+                "<tr><td>Control Mode:</td><td><select name=\"controlmode\" id=\"controlmode\">${controlmodeoptions}</select> window <input type=\"number\" id=\"pidwindow\" name=\"pidwindow\" min=\"60\" max=\"3600\" step=\"1\" value=\"${pidwindow}\"> (Seconds, PID only)</td></tr> "
+                "<tr><td>PID Gains:</td><td>Kp <input type=\"number\" id=\"pidkp\" name=\"pidkp\" min=\"0\" max=\"100\" step=\"any\" value=\"${pidkp}\"> Ki <input type=\"number\" id=\"pidki\" name=\"pidki\" min=\"0\" max=\"100\" step=\"any\" value=\"${pidki}\"> Kd <input type=\"number\" id=\"pidkd\" name=\"pidkd\" min=\"0\" max=\"100\" step=\"any\" value=\"${pidkd}\"> <a href='/admin?action=autotune'>Auto-Tune</a></td></tr> "
+                "<tr><td>Heat Relay Limits:</td><td>Min on <input type=\"number\" id=\"heatminon\" name=\"heatminon\" min=\"0\" max=\"3600\" step=\"1\" value=\"${heatminon}\"> Min off <input type=\"number\" id=\"heatminoff\" name=\"heatminoff\" min=\"0\" max=\"3600\" step=\"1\" value=\"${heatminoff}\"> (Seconds) Max <input type=\"number\" id=\"heatmaxcycles\" name=\"heatmaxcycles\" min=\"0\" max=\"60\" step=\"1\" value=\"${heatmaxcycles}\"> (Cycles/hour, 0 no limit)</td></tr> "
+                "<tr><td>Cool Relay Limits:</td><td>Min on <input type=\"number\" id=\"coolminon\" name=\"coolminon\" min=\"0\" max=\"3600\" step=\"1\" value=\"${coolminon}\"> Min off <input type=\"number\" id=\"coolminoff\" name=\"coolminoff\" min=\"0\" max=\"3600\" step=\"1\" value=\"${coolminoff}\"> (Seconds) Max <input type=\"number\" id=\"coolmaxcycles\" name=\"coolmaxcycles\" min=\"0\" max=\"60\" step=\"1\" value=\"${coolmaxcycles}\"> (Cycles/hour, 0 no limit)</td></tr> "
                 "<tr><td>Admin User:</td><td><input maxlength=\"12\" type=\"text\" value=\"${adminuser}\" name=\"adminuser\" id=\"adminuser\"></td></tr> "
                 "<tr><td>Admin Password:</td><td><input maxlength=\"12\" type=\"text\" value=\"${adminpwd}\" name=\"adminpwd\" id=\"adminpwd\"></td></tr> "
+                "<tr><td>Sensor Push Key:</td><td><input maxlength=\"32\" type=\"text\" value=\"${pushkey}\" name=\"pushkey\" id=\"pushkey\"> (Blank disables push)</td></tr> "
+                "<tr><td>Telemetry UDP Port:</td><td><input type=\"number\" id=\"udpport\" name=\"udpport\" min=\"0\" max=\"65535\" step=\"1\" value=\"${udpport}\"> (0 disables, needs push key, reboots)</td></tr> "
+                "<tr><td>TLS Session Cache:</td><td><input type=\"number\" id=\"tlscachesize\" name=\"tlscachesize\" min=\"1\" max=\"${tlscachemax}\" step=\"1\" value=\"${tlscachesize}\"> (Sessions, up to ${tlscachemax}, reboots)</td></tr> "
             "</table>"
             "<br> "
             "<button type=\"submit\">Submit</button> <a href='/'><h4>Home</h4></a>"
         "</form>"}
     ;
+    constexpr auto PROGMEM ADMIN_SETTINGS_PAGE_INDEX = HTML_TEMPLATE_INDEX(ADMIN_SETTINGS_PAGE);
 
     const char PROGMEM MANUAL_CONTROLS_ONLY_SECTION[] = {""
         "<br><hr><br>"
@@ -151,7 +160,7 @@
      * These controls are only shown on the Info Page when 
      * Auto Control is enabled.
     */
-    const char PROGMEM AUTO_CONTROLS_SECTION[] = {""
+    constexpr char PROGMEM AUTO_CONTROLS_SECTION[] = {""
         "<br><hr><br>"
         "<h2>Auto Controls</h2>" 
         "<form name=\"autoControls\" method=\"post\" id=\"autoControls\" action=\"/\"> "
@@ -179,6 +188,7 @@
             "<button type=\"submit\">Update</button>"
         "</form>"}
     ;
+    constexpr auto PROGMEM AUTO_CONTROLS_SECTION_INDEX = HTML_TEMPLATE_INDEX(AUTO_CONTROLS_SECTION);
 
     /**
      * This is the content HTML for the Update Successful 
@@ -0,0 +1,273 @@
+#ifndef HtmlTemplate_h
+    #define HtmlTemplate_h
+
+    #include <stddef.h>
+    #include <stdint.h>
+
+    /**
+     * These are all of the place-holders that can appear in the templates of
+     * HtmlContent.h. The names they are written as in the templates, minus the
+     * surrounding ${ and }, are listed in PLACEHOLDER_NAMES in the same order.
+     * NONE marks the end of a template's index.
+    */
+    enum class Placeholder : uint8_t {
+        NONE = 0,
+        TITLE,
+        HEADING,
+        CONTENT,
+        METAINSERT,
+        TEMPSENSORIP,
+        LASTKNOWNTEMP,
+        CONTROLTYPE,
+        AUTOCONTROLENABLED,
+        DEVICEONSTATUS,
+        SSID,
+        PWD,
+        SENSORIP,
+        AUTOCONTROLENABLEDCHECKED,
+        AUTOCONTROLDISABLEDCHECKED,
+        CONTROLLINGHEATCHECKED,
+        CONTROLLINGCOOLCHECKED,
+        DESIREDTEMP,
+        TEMPPADDING,
+        ADMINUSER,
+        ADMINPWD,
+        TLSCACHESIZE,
+        TLSCACHEMAX,
+        EXTRASENSORS,
+        AGGREGATIONOPTIONS,
+        POLLFLOOR,
+        POLLCEILING,
+        PUSHKEY,
+        UDPPORT,
+        CONNECTTIMEOUT,
+        READTIMEOUT,
+        FAILSAFEOPTIONS,
+        FAILSAFEAFTER,
+        FOUNDSENSORS,
+        CONTROLMODEOPTIONS,
+        PIDWINDOW,
+        PIDKP,
+        PIDKI,
+        PIDKD,
+        HEATMINON,
+        HEATMINOFF,
+        HEATMAXCYCLES,
+        COOLMINON,
+        COOLMINOFF,
+        COOLMAXCYCLES
+    };
+
+    /*
+      NAMESPACE: HtmlTemplate
+
+      This is where templates are turned into an index at compile time. An index
+      is a table of segments where each segment is a run of literal text, given
+      as an offset and length into the template, followed by the place-holder
+      that comes after it. Rendering a template is then a single pass over its
+      index without any searching. A place-holder that isn't listed in
+      PLACEHOLDER_NAMES, or one that is never closed, fails the build.
+
+      Written by: Scott Griffis
+      Date: 10-16-2026
+    */
+    namespace HtmlTemplate {
+        struct Segment {
+            uint16_t       offset                 ; // Offset of the literal run in the template
+            uint16_t       length                 ; // Length of the literal run
+            Placeholder    placeholder            ; // Place-holder following the literal run
+        };
+
+        template <size_t N>
+        struct Index {
+            Segment        segments         [N]   ;
+        };
+
+        constexpr const char *PLACEHOLDER_NAMES[] = {
+            "",
+            "title",
+            "heading",
+            "content",
+            "metainsert",
+            "tempsensorip",
+            "lastknowntemp",
+            "controltype",
+            "autocontrolenabled",
+            "deviceonstatus",
+            "ssid",
+            "pwd",
+            "sensorip",
+            "autocontrolenabledchecked",
+            "autocontroldisabledchecked",
+            "controllingheatchecked",
+            "controllingcoolchecked",
+            "desiredtemp",
+            "temppadding",
+            "adminuser",
+            "adminpwd",
+            "tlscachesize",
+            "tlscachemax",
+            "extrasensors",
+            "aggregationoptions",
+            "pollfloor",
+            "pollceiling",
+            "pushkey",
+            "udpport",
+            "connecttimeout",
+            "readtimeout",
+            "failsafeoptions",
+            "failsafeafter",
+            "foundsensors",
+            "controlmodeoptions",
+            "pidwindow",
+            "pidkp",
+            "pidki",
+            "pidkd",
+            "heatminon",
+            "heatminoff",
+            "heatmaxcycles",
+            "coolminon",
+            "coolminoff",
+            "coolmaxcycles"
+        };
+
+        // These are intentionally never defined, reaching one while building an
+        // index stops the compiler with its name in the error message.
+        void unknownPlaceholderInTemplate();
+        void unterminatedPlaceholderInTemplate();
+
+        /**
+         * Used to tell if the characters of tmpl from begin up to end exactly
+         * match the given name.
+         *
+         * @param tmpl The template as char pointer.
+         * @param begin The index of the first character to compare as size_t.
+         * @param end The index just past the last character to compare as size_t.
+         * @param name The name to compare against as char pointer.
+         *
+         * @return Returns true if they match otherwise false as bool.
+        */
+        constexpr bool nameMatches(const char *tmpl, size_t begin, size_t end, const char *name) {
+            size_t i = 0;
+            for (; begin + i < end; i++) {
+                if (name[i] == '\0' || name[i] != tmpl[begin + i]) {
+
+                    return false;
+                }
+            }
+
+            return name[i] == '\0';
+        }
+
+        /**
+         * Used to find the place-holder whose name is found in tmpl from
+         * begin up to end.
+         *
+         * @param tmpl The template as char pointer.
+         * @param begin The index of the first character of the name as size_t.
+         * @param end The index just past the last character of the name as size_t.
+         *
+         * @return Returns the matching place-holder as Placeholder.
+        */
+        constexpr Placeholder lookupPlaceholder(const char *tmpl, size_t begin, size_t end) {
+            for (size_t i = 1; i < sizeof(PLACEHOLDER_NAMES) / sizeof(PLACEHOLDER_NAMES[0]); i++) {
+                if (nameMatches(tmpl, begin, end, PLACEHOLDER_NAMES[i])) {
+
+                    return static_cast<Placeholder>(i);
+                }
+            }
+            unknownPlaceholderInTemplate();
+
+            return Placeholder::NONE;
+        }
+
+        /**
+         * Used to find the index of the '}' that closes the place-holder
+         * whose name begins at the given index.
+         *
+         * @param tmpl The template as char pointer.
+         * @param begin The index of the first character of the name as size_t.
+         *
+         * @return Returns the index of the closing '}' as size_t.
+        */
+        constexpr size_t placeholderEnd(const char *tmpl, size_t begin) {
+            size_t end = begin;
+            while (tmpl[end] != '}') {
+                if (tmpl[end] == '\0') {
+                    unterminatedPlaceholderInTemplate();
+
+                    return end;
+                }
+                end++;
+            }
+
+            return end;
+        }
+
+        /**
+         * Counts the number of segments needed to index the given template,
+         * which is one per place-holder plus one for the trailing literal.
+         *
+         * @param tmpl The template as char pointer.
+         *
+         * @return Returns the number of segments as size_t.
+        */
+        constexpr size_t countSegments(const char *tmpl) {
+            size_t count = 1;
+            size_t i = 0;
+            while (tmpl[i] != '\0') {
+                if (tmpl[i] == '$' && tmpl[i + 1] == '{') {
+                    i = placeholderEnd(tmpl, i + 2) + 1;
+                    count++;
+
+                    continue;
+                }
+                i++;
+            }
+
+            return count;
+        }
+
+        /**
+         * Builds the index of the given template. The final segment of the
+         * index holds the trailing literal and a place-holder of NONE.
+         *
+         * @param tmpl The template as char pointer.
+         *
+         * @return Returns the built index as Index.
+        */
+        template <size_t N>
+        constexpr Index<N> buildIndex(const char *tmpl) {
+            Index<N> index = {};
+            size_t segment = 0;
+            size_t literal = 0;
+            size_t i = 0;
+            while (tmpl[i] != '\0') {
+                if (tmpl[i] == '$' && tmpl[i + 1] == '{') {
+                    size_t end = placeholderEnd(tmpl, i + 2);
+                    index.segments[segment].offset = static_cast<uint16_t>(literal);
+                    index.segments[segment].length = static_cast<uint16_t>(i - literal);
+                    index.segments[segment].placeholder = lookupPlaceholder(tmpl, i + 2, end);
+                    segment++;
+
+                    i = end + 1;
+                    literal = i;
+
+                    continue;
+                }
+                i++;
+            }
+            index.segments[segment].offset = static_cast<uint16_t>(literal);
+            index.segments[segment].length = static_cast<uint16_t>(i - literal);
+            index.segments[segment].placeholder = Placeholder::NONE;
+
+            return index;
+        }
+    }
+
+    /**
+     * Expands to the compile time index of the given constexpr template.
+    */
+    #define HTML_TEMPLATE_INDEX(tmpl) HtmlTemplate::buildIndex<HtmlTemplate::countSegments(tmpl)>(tmpl)
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef StaticAssets_h
+    #define StaticAssets_h
+
+    #include <pgmspace.h>
+    #include <stdint.h>
+
+    /*
+     * GENERATED FILE - DO NOT EDIT!!!
+     * This file is generated from the assets directory by scripts/build_assets.py
+     * during the build. Make changes to the assets themselves instead.
+    */
+
+    // style.css: 662 bytes minified, 322 bytes gzipped
+    #define STYLE_CSS_VERSION "4a36abcaa807"
+    #define STYLE_CSS_ETAG "\"4a36abcaa807\""
+    const uint32_t STYLE_CSS_GZ_LENGTH = 322U;
+    const uint8_t PROGMEM STYLE_CSS_GZ[] = {
+        0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8D, 0x51, 0xED, 0x6E, 0x83, 0x20,
+        0x14, 0x7D, 0x15, 0x13, 0xB3, 0x9F, 0x2C, 0x88, 0xB5, 0xED, 0xE0, 0xD7, 0xD6, 0xB5, 0xEF, 0x81,
+        0x82, 0x42, 0xC6, 0xB8, 0x06, 0x70, 0xBA, 0x19, 0xDE, 0x7D, 0xD6, 0xD6, 0x2E, 0x4B, 0xBB, 0x8F,
+        0x9B, 0x90, 0x9C, 0x7B, 0x02, 0x87, 0x7B, 0xCE, 0x2D, 0x41, 0xBC, 0x8F, 0x25, 0xAF, 0x5E, 0x1A,
+        0x07, 0x9D, 0x15, 0xA8, 0x02, 0x03, 0x8E, 0xA6, 0x87, 0xB9, 0xD8, 0xB9, 0xC3, 0x73, 0x45, 0x95,
+        0x8D, 0x41, 0x0E, 0x01, 0x71, 0xA3, 0x1B, 0x4B, 0x2B, 0x69, 0x83, 0x74, 0xEC, 0xFA, 0x6D, 0xB1,
+        0xDD, 0x6C, 0x9F, 0x30, 0xFB, 0xAE, 0x54, 0x82, 0x13, 0xD2, 0xD1, 0xBC, 0x1D, 0xCE, 0x10, 0x39,
+        0x2E, 0x74, 0xE7, 0x69, 0x56, 0xB4, 0x43, 0x54, 0xE4, 0x9F, 0xCA, 0x8F, 0xCF, 0xBF, 0x28, 0xC7,
+        0xD4, 0x77, 0x55, 0x25, 0xBD, 0xAF, 0x3B, 0x73, 0x43, 0x6F, 0x31, 0x43, 0x76, 0x87, 0xFC, 0x21,
+        0xA6, 0x35, 0xD7, 0x46, 0x8A, 0x9F, 0xEF, 0xED, 0x0E, 0x98, 0x60, 0x12, 0xD3, 0xDE, 0xF1, 0xB6,
+        0x95, 0xEE, 0x46, 0x48, 0xFB, 0xF5, 0xFE, 0x38, 0x40, 0xCB, 0x85, 0xD0, 0xB6, 0xA1, 0x04, 0x4F,
+        0xE6, 0x5E, 0xB9, 0x6B, 0xB4, 0x45, 0x46, 0xD6, 0x81, 0xF2, 0x2E, 0xC0, 0x42, 0x38, 0xDD, 0xA8,
+        0x0B, 0x33, 0xA0, 0x5E, 0x8B, 0xA0, 0xE8, 0x06, 0xE3, 0x39, 0x8F, 0x01, 0x79, 0xC5, 0x05, 0xF4,
+        0x47, 0x13, 0xC9, 0x72, 0xD2, 0x3C, 0xCF, 0x63, 0xAA, 0x6D, 0x0D, 0x63, 0x0D, 0x36, 0x20, 0xAF,
+        0x3F, 0x24, 0x25, 0x53, 0x5A, 0x6C, 0x6E, 0x7B, 0x39, 0x2B, 0x96, 0x60, 0x04, 0x33, 0xDA, 0x4A,
+        0xA4, 0x4E, 0x44, 0x56, 0xE0, 0xBB, 0x58, 0x76, 0x21, 0x80, 0x1D, 0xFF, 0xD8, 0x4D, 0xAF, 0x74,
+        0x90, 0xEC, 0x4B, 0x3C, 0x5B, 0x4F, 0xE2, 0x8B, 0x9B, 0x6C, 0x1A, 0x2D, 0x21, 0xAB, 0xEB, 0x7D,
+        0x91, 0x0B, 0x45, 0x27, 0x98, 0x78, 0x30, 0x5A, 0x24, 0xA5, 0x99, 0xBE, 0x62, 0xC1, 0x71, 0xEB,
+        0x75, 0xD0, 0x60, 0x91, 0xE8, 0x1C, 0x3F, 0x02, 0x8A, 0xEF, 0x57, 0xFE, 0x3C, 0x0F, 0x55, 0xF0,
+        0x76, 0x2B, 0xC8, 0xD3, 0x1C, 0x27, 0x3C, 0x0B, 0xC5, 0x4F, 0x09, 0xFA, 0x2D, 0xE9, 0x96, 0x02,
+        0x00, 0x00,
+    };
+
+#endif
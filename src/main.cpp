@@ -20,6 +20,9 @@
   Hosted Endpoints:
   /        - This is where the device's information is deplayed as a web page
   /admin   - This is where the device's settings are configured. Default User: admin, Default Password: admin
+  /api/status - This is where the device's current state can be read as JSON
+  /api/events - This is a Server-Sent Events stream of temperature and outlet state changes
+  /api/push   - This is where a TempBuddy Sensor can push its readings rather than be polled
 
   More Detailed:
   When device is first programmed it boots up as an AccessPoint that can be connected to using a computer,
@@ -74,8 +77,20 @@
 #include <MyWiFi.h>
 #include <Settings.h>
 #include <ParseUtils.h>
+#include <ResponseWriter.h>
+#include <EventStream.h>
+#include <TlsSessionCache.h>
+#include <SensorClient.h>
+#include <TempAggregator.h>
+#include <PollInterval.h>
+#include <UdpTelemetry.h>
+#include <HostResolver.h>
+#include <CoopScheduler.h>
+#include <PidController.h>
+#include <RelayAutoTune.h>
+#include <RelayGuard.h>
+#include <CentiTemp.h>
 
-#include <ESP8266HTTPClient.h>
 #include <WString.h>
 
 // ************************************************************************************
@@ -88,31 +103,99 @@
 #define OUTLET_PIN 4
 #define RESTORE_PIN 14
 
+#define INFO_PAGE_CACHE_RESERVE 4096U
+#define SENSOR_STALE_GRACE_MS 30000UL // Added to twice the poll interval to tell when a reading is stale
+#define PUSH_STALE_MS 120000UL // A sensor that hasn't pushed a reading for this long is polled again
+#define RELAY_TOGGLE_SAVE_MS 43200000UL // Least time between saving the relay toggle total to flash
+
+// What the outlet does under Auto Control while the last known temp is too stale to act on...
+enum FailSafePolicy : uint8_t {
+  FAIL_SAFE_OFF = 0, // Outlet is turned off
+  FAIL_SAFE_ON, // <--- Outlet is turned on
+  FAIL_SAFE_HOLD // <-- Outlet is left as it is
+};
+const char *FAIL_SAFE_POLICY_NAMES[] = {"off", "on", "hold"};
+
+// How the outlet is driven under Auto Control...
+enum ControlMode : uint8_t {
+  CONTROL_HYSTERESIS = 0, // Switched at the desired temp and at the desired temp -/+ the padding
+  CONTROL_PID // <--------- Time-proportioned by the PID controller
+};
+const char *CONTROL_MODE_NAMES[] = {"hysteresis", "pid"};
+
+// An ECDSA server cert is used when SERVER_CERT_IS_EC is defined, either by
+// Secrets.h or as a build flag. BearSSL's basic mode has no EC support.
+#ifdef SERVER_CERT_IS_EC
+  #ifdef BEARSSL_SSL_BASIC
+    #error "ECDSA server certs need full BearSSL, build without BEARSSL_SSL_BASIC (see env:nodemcuv2_ec)."
+  #endif
+  #ifndef SERVER_CERT_ISSUER_KEY_TYPE
+    #define SERVER_CERT_ISSUER_KEY_TYPE BR_KEYTYPE_EC // Key type of the CA that signed the cert
+  #endif
+#endif
+
 // ************************************************************************************
 // Setup of Services
 // ************************************************************************************
 Settings settings = Settings();
 MyWiFi myWifi = MyWiFi();
 BearSSL::ESP8266WebServerSecure webServer(/*Port*/443);
-BearSSL::ServerSessions serverCache(5);
+TlsSessionCache tlsSessionCache = TlsSessionCache();
+ResponseWriter responseWriter = ResponseWriter();
+EventStream eventStream = EventStream();
+SensorClient sensorClients[TEMP_SENSOR_MAX_COUNT];
+PollInterval pollInterval = PollInterval();
+UdpTelemetry udpTelemetry = UdpTelemetry();
+HostResolver hostResolver = HostResolver();
+CoopScheduler scheduler = CoopScheduler();
+PidController pidController = PidController();
+RelayAutoTune autoTune = RelayAutoTune();
+RelayGuard relayGuard = RelayGuard();
 
 // ************************************************************************************
 // Global worker variables
 // ************************************************************************************
 bool firstLoop = true;
 String deviceId = "";
+uint32_t bootId = 0U;
+String cachedInfoPage = "";
+unsigned long cachedInfoPageVersion = 0UL;
+TempAggregator::Reading sensorReadings[TEMP_SENSOR_MAX_COUNT] = {};
+unsigned long sensorPushedAt[TEMP_SENSOR_MAX_COUNT] = {};
 
 // ************************************************************************************
 // Function Prototypes
 // ************************************************************************************
 
 void dumpFirmwareVersion(void);
-void doHandleReadTempBuddy(void);
+bool doHandleReadTempBuddy(void);
+void updateLastKnownTemp(void);
+bool recordPushedReading(uint8_t index, int16_t centiF);
+void doHandleUdpTelemetry(void);
 void doHandleDeviceOperations(void);
+bool isTempReadingStale(void);
+void finishAutoTune(void);
+uint32_t foldRelayToggles(void);
+void doHandleRelayToggleSave(void);
+void doHandleEventStream(void);
 void resetOrLoadSettings(void);
 void doStartNetwork(void);
 void checkIpDisplayRequest(void);
 
+typedef std::function<void(void)> ContentWriter;
+typedef std::function<void(Placeholder placeholder)> PlaceholderHandler;
+
+void beginResponse(int code, const char *contentType, size_t contentLength = CONTENT_LENGTH_UNKNOWN);
+void endResponse(void);
+void writeTemplate_P(PGM_P tmpl, const HtmlTemplate::Segment *index, const PlaceholderHandler &handler);
+void printTemp(int16_t centi);
+void printFoundSensors(void);
+void setJsonTemp(JsonVariant target, int16_t centi);
+void printNumber(float value, uint8_t decimals);
+void setJsonNumber(JsonVariant target, float value, uint8_t decimals);
+bool parseFormLong(const String &arg, long &value);
+bool parseFormFloat(const String &arg, float &value);
+
 void sendHtmlPageUsingTemplate(
   int code,
   String title,
@@ -121,12 +204,35 @@ void sendHtmlPageUsingTemplate(
   String redirectUrl = "",
   int delaySeconds = 3
 );
+void writeHtmlPage(
+  const String &title,
+  const String &heading,
+  const ContentWriter &contentWriter,
+  const String &redirectUrl,
+  int delaySeconds
+);
+String getStateETag(void);
+bool handleStateConditionalGet(void);
+void sendHtmlPageUsingTemplate(
+  int code,
+  const String &title,
+  const String &heading,
+  const ContentWriter &contentWriter,
+  const String &redirectUrl = "",
+  int delaySeconds = 3
+);
 
 void fileUploadHandler(void);
 void notFoundHandler(void);
 void endpointHandlerAdmin(void);
 void endpointHandlerRoot(void);
+void endpointHandlerApiStatus(void);
+void endpointHandlerApiEvents(void);
+void endpointHandlerApiPush(void);
+bool pushKeyMatches(const String &authorization, const char *pushKey);
+void endpointHandlerStyle(void);
 void initWebServer(void);
+void initScheduler(void);
 
 /**
  * #### SETUP() - REQUIRED FUNCTION ####
@@ -148,12 +254,21 @@ void setup() {
     delay(15);
 
     // Initialize the device...
+    bootId = ESP.random();
     dumpFirmwareVersion();
     Serial.print(F("\nInitializing device... "));
 
     resetOrLoadSettings();
     doStartNetwork();
+    SensorClient::setResolver(&hostResolver);
+    if (settings.isNetworkSet() && hostResolver.begin(settings.getHostname(deviceId))) { // mDNS is available...
+        Serial.printf("mDNS responding as '%s.local'.\n", settings.getHostname(deviceId).c_str());
+    }
     initWebServer();
+    if (udpTelemetry.begin(settings.getUdpPort(), settings.getPushKey(), bootId)) { // UDP telemetry is enabled...
+        Serial.printf("UDP telemetry is listening on port %u.\n", udpTelemetry.getPort());
+    }
+    initScheduler();
     delay(50);
 
     Serial.println(F("Device Initialization Complete."));
@@ -163,7 +278,8 @@ void setup() {
  * #### LOOP() - REQUIRED FUNCTION ####
  *
  * This is the required loop() function of the applicaiton.
- * Here is where all functionality happens or starts to happen.
+ * Here is where all functionality happens or starts to happen,
+ * as tasks of the scheduler, see initScheduler().
 */
 void loop() {
     if (firstLoop) { // It's the firt time through the loop...
@@ -171,14 +287,26 @@ void loop() {
         Serial.println(F("Device has begun normal operation."));
     }
 
-    checkIpDisplayRequest();
-
-    // Handle incoming web requests...
-    webServer.handleClient();
+    scheduler.run();
+}
 
-    doHandleReadTempBuddy();
-    doHandleDeviceOperations();
-    delay(15);
+/**
+ * #### INITIALIZE ####
+ * This is an initialization function for the scheduler. It sets up the
+ * device's work as tasks, in order of priority: controlling the outlet,
+ * then reading the sensors, then serving clients, then the indicators and
+ * housekeeping. Periods are in milliseconds, as are the deadlines, which
+ * are counted from when a task becomes due.
+*/
+void initScheduler() {
+    scheduler.addTask("control", []() { doHandleDeviceOperations(); return false; }, 100UL, CoopScheduler::CRITICAL, 50UL);
+    scheduler.addTask("sensors", doHandleReadTempBuddy, 20UL, CoopScheduler::ELEVATED, 100UL);
+    scheduler.addTask("web", []() { webServer.handleClient(); return false; }, 5UL, CoopScheduler::NORMAL, 50UL);
+    scheduler.addTask("events", []() { doHandleEventStream(); return false; }, 50UL, CoopScheduler::NORMAL, 100UL);
+    scheduler.addTask("udp", []() { doHandleUdpTelemetry(); return false; }, 20UL, CoopScheduler::NORMAL, 50UL);
+    scheduler.addTask("resolver", []() { hostResolver.handle(); return false; }, 50UL, CoopScheduler::BACKGROUND, 100UL);
+    scheduler.addTask("ipdisplay", []() { checkIpDisplayRequest(); return false; }, 100UL, CoopScheduler::BACKGROUND, 100UL);
+    scheduler.addTask("togglesave", []() { doHandleRelayToggleSave(); return false; }, 60000UL, CoopScheduler::BACKGROUND, 500UL);
 }
 
 /**
@@ -250,85 +378,382 @@ void checkIpDisplayRequest() {
   }
 }
 
+// Used by the doHandleDeviceOperations function below...
+unsigned long controlModeCycles[] = {0UL, 0UL}; // Times the outlet was switched on, by ControlMode
+unsigned long controlModeMillis[] = {0UL, 0UL}; // Time spent controlling, by ControlMode
+unsigned long lastDeviceOperationAt = 0UL;
+
 /**
  * This function handles the operations that are specific to the device.
  * Specifically speaking it handles turning on or off the controlled outlet
  * based on user input if in Manual Mode or based on Temperature if in Auto Mode.
+ * In Auto Mode the outlet is either switched with hysteresis around the desired
+ * temperature or, in PID mode, time-proportioned by pidController, unless an
+ * auto-tune is running, in which case autoTune switches it.
+ * Whatever asks for the outlet to be switched, relayGuard has the final say so that the
+ * minimum on/off times and cycles per hour limits of the heat or cool mode are kept.
  * This is the only place in code that should be controlling the controlled outlet
  * of the device. Everywere else simply interacts with this function by maintaining
  * the key values in settings.
 */
 void doHandleDeviceOperations() {
+    unsigned long now = millis();
+    int controllingMode = -1; // The ControlMode in charge of the outlet this time, if any
+    // FYI: Temperatures are in hundredths of a degree F, widened so adding the padding can't overflow...
+    int32_t lastKnownTemp = settings.getLastKnownTempCenti();
+    int32_t desiredTemp = settings.getDesiredTempCenti();
+    int32_t tempPadding = settings.getTempPaddingCenti();
+
     // Handle the Auto Control functionality...
-    if (settings.getIsAutoControl() && !settings.getTempSensorIp().isEmpty()) { // Auto Control is active...
-        if (settings.getIsHeat()) { // In Heat control mode...
-            if (settings.getLastKnownTemp() > settings.getDesiredTemp()) { // It is too warm...
+    if (settings.getIsAutoControl() && settings.isTempSensorSet()) { // Auto Control is active...
+        if (isTempReadingStale()) { // Last known temp can't be trusted...
+            autoTune.cancel();
+            pidController.reset();
+            if (settings.getFailSafePolicy() == FAIL_SAFE_OFF) {
                 settings.setIsControlOn(false);
-            } else if (settings.getLastKnownTemp() < settings.getDesiredTemp() - settings.getTempPadding()) { // It's too cool...
+            } else if (settings.getFailSafePolicy() == FAIL_SAFE_ON) {
                 settings.setIsControlOn(true);
             }
-        } else { // In Cold control mode...
-            if (settings.getLastKnownTemp() < settings.getDesiredTemp()) { // It is too cold...
-                settings.setIsControlOn(false);
-            } else if (settings.getLastKnownTemp() > settings.getDesiredTemp() + settings.getTempPadding()) { // It's too warm...
-                settings.setIsControlOn(true);
+        } else if (autoTune.isRunning()) { // Auto-tune is switching the outlet...
+            settings.setIsControlOn(autoTune.update(CentiTemp::toFloat(lastKnownTemp), now));
+            if (!autoTune.isRunning()) { // Auto-tune just ended...
+                finishAutoTune();
+            }
+        } else if (settings.getControlMode() == CONTROL_PID) { // In PID control mode...
+            controllingMode = CONTROL_PID;
+            pidController.setGains(settings.getPidKp(), settings.getPidKi(), settings.getPidKd());
+            pidController.setWindow(settings.getPidWindowSec() * 1000UL);
+            settings.setIsControlOn(
+                pidController.update(CentiTemp::toFloat(desiredTemp), CentiTemp::toFloat(lastKnownTemp), settings.getIsHeat(), now)
+            );
+        } else { // In hysteresis control mode...
+            controllingMode = CONTROL_HYSTERESIS;
+            if (settings.getIsHeat()) { // In Heat control mode...
+                if (lastKnownTemp > desiredTemp) { // It is too warm...
+                    settings.setIsControlOn(false);
+                } else if (lastKnownTemp < desiredTemp - tempPadding) { // It's too cool...
+                    settings.setIsControlOn(true);
+                }
+            } else { // In Cold control mode...
+                if (lastKnownTemp < desiredTemp) { // It is too cold...
+                    settings.setIsControlOn(false);
+                } else if (lastKnownTemp > desiredTemp + tempPadding) { // It's too warm...
+                    settings.setIsControlOn(true);
+                }
             }
         }
+    } else { // Manual control, nothing automatic may run...
+        autoTune.cancel();
+    }
+    if (controllingMode != CONTROL_PID) { // PID starts over when it is next in charge...
+        pidController.reset();
+    }
+    if (controllingMode >= 0 && lastDeviceOperationAt != 0UL) {
+        controlModeMillis[controllingMode] += now - lastDeviceOperationAt;
     }
+    lastDeviceOperationAt = now;
 
     // Handle the toggling of the controlled device on/off...
-    if (settings.getIsControlOn()) { // Controls should be ON...
+    bool isHeat = settings.getIsHeat();
+    relayGuard.setLimits(
+        settings.getMinOnSec(isHeat) * 1000UL,
+        settings.getMinOffSec(isHeat) * 1000UL,
+        settings.getMaxCyclesPerHour(isHeat)
+    );
+    RelayGuard::Hold holdBefore = relayGuard.getHold();
+    bool outletChanged = false;
+    if (relayGuard.apply(settings.getIsControlOn(), now)) { // Controls should be ON...
         if (digitalRead(OUTLET_PIN) == LOW) { // Control is NOT on but should be...
            digitalWrite(OUTLET_PIN, HIGH);
+           outletChanged = true;
+           if (controllingMode >= 0) {
+               controlModeCycles[controllingMode]++;
+           }
         }
     } else { // Controls should be OFF...
         if (digitalRead(OUTLET_PIN) == HIGH) { // Controls is ON but should NOT be...
             digitalWrite(OUTLET_PIN, LOW);
+            outletChanged = true;
         }
     }
+
+    // FYI: The guard can switch the outlet, or start or end a hold, without any setter being called...
+    if (outletChanged || relayGuard.getHold() != holdBefore) {
+        settings.markLiveStateChanged();
+    }
+}
+
+// Used by the foldRelayToggles and doHandleRelayToggleSave functions below...
+unsigned long foldedRelayToggles = 0UL;
+unsigned long lastRelayToggleSave = 0UL;
+
+/**
+ * Used to add the relay toggles made since last time into the toggle total kept in settings,
+ * without saving it. This is called before settings are saved anyway so the total goes along
+ * for free.
+ *
+ * @return Returns the up to date toggle total as uint32_t.
+*/
+uint32_t foldRelayToggles() {
+    unsigned long toggles = relayGuard.getToggleCount();
+    if (toggles != foldedRelayToggles) { // Some are new...
+        settings.setRelayToggleTotal(settings.getRelayToggleTotal() + (toggles - foldedRelayToggles));
+        foldedRelayToggles = toggles;
+    }
+
+    return settings.getRelayToggleTotal();
 }
 
+/**
+ * This function handles saving the relay toggle total to flash. As each save wears the flash
+ * it is only done when there are new toggles and RELAY_TOGGLE_SAVE_MS has passed since the
+ * last time, so up to that long of toggles can be lost to a power cut.
+*/
+void doHandleRelayToggleSave() {
+    if (
+        relayGuard.getToggleCount() == foldedRelayToggles
+        || millis() - lastRelayToggleSave < RELAY_TOGGLE_SAVE_MS
+    ) { // Nothing new or too soon...
+
+        return;
+    }
+
+    foldRelayToggles();
+    settings.saveSettings();
+    lastRelayToggleSave = millis();
+}
+
+/**
+ * Called when an auto-tune has ended. When it worked the gains it found are saved and
+ * PID control mode is taken up.
+*/
+void finishAutoTune() {
+    if (autoTune.getState() != RelayAutoTune::DONE) { // Didn't work out...
+        Serial.println(F("Auto-tune failed, the PID gains were left as they were."));
+
+        return;
+    }
+
+    Serial.printf("Auto-tune found Kp=%.4f Ki=%.4f Kd=%.4f.\n", autoTune.getKp(), autoTune.getKi(), autoTune.getKd());
+    settings.setPidGains(autoTune.getKp(), autoTune.getKi(), autoTune.getKd());
+    settings.setControlMode(CONTROL_PID);
+    foldRelayToggles();
+    settings.saveSettings();
+}
+
+// Used by the doHandleEventStream function below...
+unsigned long lastPublishedLiveStateVersion = 0UL;
+
+/**
+ * Used to write the live state of the device, the last known temperature,
+ * whether the outlet is asked to be on and whether it actually is, as a
+ * compact JSON object into the given buffer.
+ *
+ * @param buffer The buffer to write into as char pointer.
+ * @param size The size of the buffer as size_t.
+*/
+void buildLiveStateEvent(char *buffer, size_t size) {
+  JsonDocument doc;
+  setJsonTemp(doc["last_known_temp"].to<JsonVariant>(), settings.getLastKnownTempCenti());
+  doc["is_control_on"] = settings.getIsControlOn();
+  doc["is_on"] = digitalRead(OUTLET_PIN) == HIGH;
+  serializeJson(doc, buffer, size);
+}
+
+/**
+ * This function handles the Server-Sent Events stream. When the live state
+ * of the device has changed since it was last published an event is sent
+ * to all subscribers, otherwise subscribers are only kept alive.
+*/
+void doHandleEventStream() {
+  if (settings.getLiveStateVersion() != lastPublishedLiveStateVersion) { // Something changed...
+    lastPublishedLiveStateVersion = settings.getLiveStateVersion();
+    if (eventStream.getSubscriberCount() > 0U) { // Someone is listening...
+      char data[96];
+      buildLiveStateEvent(data, sizeof(data));
+      eventStream.publish("state", data);
+    }
+  } else {
+    eventStream.keepAlive();
+  }
+}
 
 // Used by the doHandleReadTempBuddy function below...
 unsigned long lastTempBuddyRead = 0UL;
+unsigned long lastSuccessfulTempRead = 0UL;
+bool failSafeActive = false;
 
 /**
- * This function handles reaching out to the TempBuddy device for the current temperature
- * periodically. This functionality is throttled to only run once a minute as running it too
- * often can degrade the device's ability to provide other functionality like answer clients'
- * web requests and signal IP Address as requested.
+ * Used to tell if the last known temperature is too old for Auto Control to act on, so that
+ * the outlet isn't left switched by a reading that has frozen because the sensors can't be
+ * reached. Until the first reading arrives the time since boot is used as its age. A fail-safe
+ * age of zero turns this off.
+ *
+ * @return Returns true if stale otherwise false as bool.
 */
-void doHandleReadTempBuddy() {
-    if (!settings.getTempSensorIp().isEmpty() && (lastTempBuddyRead == 0UL || millis() - lastTempBuddyRead >= 60000)) { // Need to check TempBuddy...
+bool isTempReadingStale() {
+    unsigned long maxAge = settings.getFailSafeAfterSec() * 1000UL;
+    bool stale = maxAge != 0UL && millis() - lastSuccessfulTempRead >= maxAge;
+    if (stale != failSafeActive) { // Going into or out of fail-safe...
+        failSafeActive = stale;
+        Serial.printf(
+            (stale ? "Temp reading is stale, fail-safe '%s' applied.\n" : "Temp reading is fresh again, fail-safe '%s' lifted.\n"),
+            FAIL_SAFE_POLICY_NAMES[settings.getFailSafePolicy()]
+        );
+    }
+
+    return stale;
+}
+
+/**
+ * This function handles reaching out to the TempBuddy devices for the current temperature
+ * periodically. How often reads are started is worked out by pollInterval, which reads more
+ * often as the temperature nears the point where the outlet is switched or is changing
+ * quickly, and less often while it is stable. All of
+ * the configured sensors are read at the same time, each read being carried forward a little
+ * each time through the loop so that it doesn't degrade the device's ability to provide other
+ * functionality like answer clients' web requests and signal IP Address as requested. As
+ * readings come in they are combined into the last known temperature using the configured
+ * aggregation policy.
+ *
+ * @return Returns true while a read is still in progress otherwise false as bool.
+*/
+bool doHandleReadTempBuddy() {
+    pollInterval.setBounds(settings.getPollFloorSec() * 1000UL, settings.getPollCeilingSec() * 1000UL);
+    for (uint8_t i = 0U; i < TEMP_SENSOR_MAX_COUNT; i++) {
+        sensorClients[i].setTimeouts(settings.getSensorConnectTimeoutMs(), settings.getSensorReadTimeoutMs());
+    }
+    if (
+      settings.isTempSensorSet()
+      && (lastTempBuddyRead == 0UL || millis() - lastTempBuddyRead >= pollInterval.getInterval())
+    ) { // Need to check TempBuddy...
         lastTempBuddyRead = millis();
-        if (ParseUtils::validDotNotationIp(settings.getTempSensorIp())) { // IP Address is valid...
-            if (myWifi.isConnected()) { // Connected to WiFi...
-                WiFiClientSecure client;
-                client.setInsecure();
-                HTTPClient https;
-
-                https.begin(client, settings.getTempSensorIp(), 443, "/api/info");
-
-                int respCode = https.GET();
-                if (respCode >= 200 && respCode <= 299) { // Good response...
-                    Serial.printf("Got a '%d' response code from TempBuddy.\n", respCode);
-                    String payload = https.getString();
-                    if (!payload.isEmpty()) { // Something in payload...
-                      JsonDocument data;
-                      deserializeJson(data, payload);
-                      if (String(data["temp_unit"]).equalsIgnoreCase("f")) {
-                        settings.setLastKnownTemp(data["temp"]);
-                      } else if (String(data["temp_unit"]).equalsIgnoreCase("c")) {
-                        float temp = data["temp"];
-                        settings.setLastKnownTemp(((temp * 9/5) + 32));
-                      }
-                    }
+        if (myWifi.isConnected()) { // Connected to WiFi...
+            for (uint8_t i = 0U; i < TEMP_SENSOR_MAX_COUNT; i++) {
+                if (!settings.isTempSensorSet(i)) { // Sensor not in use...
+                    sensorClients[i].begin("");
+                    sensorReadings[i].hasReading = false;
+
+                    continue;
                 }
+                sensorClients[i].begin(settings.getTempSensorHostCStr(i));
+                if (sensorPushedAt[i] != 0UL && millis() - sensorPushedAt[i] < PUSH_STALE_MS) { // Sensor is pushing...
 
-                https.end();
-              }
-          }
-      }
+                    continue;
+                }
+                sensorClients[i].start(); // FYI: Does nothing if the last read is still going or while backing off.
+            }
+        }
+    }
+
+    bool gotReading = false;
+    bool inProgress = false;
+    for (uint8_t i = 0U; i < TEMP_SENSOR_MAX_COUNT; i++) {
+        int16_t centiF = 0;
+        bool completed = sensorClients[i].run(centiF);
+        inProgress = inProgress || sensorClients[i].isBusy();
+        if (completed) { // Read completed...
+            sensorReadings[i].centiF = centiF;
+            sensorReadings[i].readAt = millis();
+            sensorReadings[i].hasReading = true;
+            gotReading = true;
+            if (!sensorClients[i].getLastReused()) { // A handshake was done...
+                Serial.printf(
+                    "TempBuddy '%s' handshake took %lums (%s).\n",
+                    sensorClients[i].getHost().c_str(),
+                    sensorClients[i].getLastHandshakeMillis(),
+                    (sensorClients[i].getLastResumed() ? "resumed" : "full")
+                );
+            }
+        }
+    }
+
+    if (gotReading) { // Something new to go on...
+        updateLastKnownTemp();
+    }
+
+    return inProgress;
+}
+
+/**
+ * Combines the latest readings of the TempBuddy Sensors, whether polled or pushed, into the
+ * last known temperature using the configured aggregation policy. The result is also given
+ * to pollInterval so it can work out when to read next.
+*/
+void updateLastKnownTemp() {
+    int16_t centiF = 0;
+    if (
+      TempAggregator::aggregate(
+        sensorReadings,
+        TEMP_SENSOR_MAX_COUNT,
+        (TempAggregator::Policy) settings.getAggregationPolicy(),
+        millis(),
+        2UL * pollInterval.getInterval() + SENSOR_STALE_GRACE_MS,
+        centiF
+      )
+    ) { // Have a new temperature...
+        settings.setLastKnownTempCenti(centiF);
+        lastSuccessfulTempRead = millis();
+
+        // FYI: These are the thresholds doHandleDeviceOperations() switches the outlet at...
+        float tempF = CentiTemp::toFloat(centiF);
+        float desiredTemp = CentiTemp::toFloat(settings.getDesiredTempCenti());
+        float tempPadding = CentiTemp::toFloat(settings.getTempPaddingCenti());
+        if (settings.getIsHeat()) {
+            pollInterval.update(tempF, desiredTemp - tempPadding, desiredTemp, millis());
+        } else {
+            pollInterval.update(tempF, desiredTemp, desiredTemp + tempPadding, millis());
+        }
+    }
+}
+
+/**
+ * Takes a reading pushed by a TempBuddy Sensor, either to /api/push or over UDP, straight
+ * into the last known temperature and acts on the outlet right away. The sensor won't be
+ * polled until its pushes go stale.
+ *
+ * @param index The index of the sensor as uint8_t.
+ * @param centiF The temperature in hundredths of a degree F as int16_t.
+ *
+ * @return Returns true if taken or false if the sensor isn't configured as bool.
+*/
+bool recordPushedReading(uint8_t index, int16_t centiF) {
+    if (!settings.isTempSensorSet(index)) { // Not a configured sensor...
+
+        return false;
+    }
+
+    sensorReadings[index].centiF = centiF;
+    sensorReadings[index].readAt = millis();
+    sensorReadings[index].hasReading = true;
+    sensorPushedAt[index] = millis();
+
+    updateLastKnownTemp();
+    doHandleDeviceOperations();
+
+    return true;
+}
+
+/**
+ * This function handles the optional UDP channel, taking in the readings sensors have sent
+ * and broadcasting the status beacon when it is due.
+*/
+void doHandleUdpTelemetry() {
+    udpTelemetry.handle([](uint8_t sensor, int16_t centiF) {
+        recordPushedReading(sensor, centiF);
+    });
+
+    if (udpTelemetry.isBeaconDue()) {
+        udpTelemetry.sendBeacon(
+            settings.getIsControlOn(),
+            settings.getIsHeat(),
+            settings.getIsAutoControl(),
+            settings.getLastKnownTempCenti(),
+            settings.getDesiredTempCenti(),
+            settings.getTempPaddingCenti(),
+            (lastSuccessfulTempRead == 0UL ? ULONG_MAX : (millis() - lastSuccessfulTempRead) / 1000UL)
+        );
+    }
 }
 
 /**
@@ -350,15 +775,30 @@ void dumpFirmwareVersion() {
 */
 void initWebServer() {
   #ifndef Secrets_h
-    webServer.getServer().setRSACert(new BearSSL::X509List(SAMPLE_SERVER_CERT), new BearSSL::PrivateKey(SAMPLE_SERVER_KEY));
+    #ifdef SERVER_CERT_IS_EC
+      webServer.getServer().setECCert(new BearSSL::X509List(SAMPLE_SERVER_EC_CERT), SERVER_CERT_ISSUER_KEY_TYPE, new BearSSL::PrivateKey(SAMPLE_SERVER_EC_KEY));
+    #else
+      webServer.getServer().setRSACert(new BearSSL::X509List(SAMPLE_SERVER_CERT), new BearSSL::PrivateKey(SAMPLE_SERVER_KEY));
+    #endif
   #else
-    webServer.getServer().setRSACert(new BearSSL::X509List(server_cert), new BearSSL::PrivateKey(server_key));
+    #ifdef SERVER_CERT_IS_EC
+      webServer.getServer().setECCert(new BearSSL::X509List(server_cert), SERVER_CERT_ISSUER_KEY_TYPE, new BearSSL::PrivateKey(server_key));
+    #else
+      webServer.getServer().setRSACert(new BearSSL::X509List(server_cert), new BearSSL::PrivateKey(server_key));
+    #endif
   #endif
-  webServer.getServer().setCache(&serverCache);
+  webServer.getServer().setCache(tlsSessionCache.begin(settings.getTlsSessionCacheSize()));
+
+  const char *collectedHeaders[] = {"If-None-Match"};
+  webServer.collectHeaders(collectedHeaders, 1);
 
   /* Setup Endpoint Handlers */
   webServer.on(F("/"), endpointHandlerRoot);
   webServer.on(F("/admin"), endpointHandlerAdmin);
+  webServer.on(F("/api/status"), HTTP_GET, endpointHandlerApiStatus);
+  webServer.on(F("/api/events"), HTTP_GET, endpointHandlerApiEvents);
+  webServer.on(F("/api/push"), HTTP_POST, endpointHandlerApiPush);
+  webServer.on(F("/style.css"), HTTP_GET, endpointHandlerStyle);
   webServer.onNotFound(notFoundHandler);
   webServer.onFileUpload(fileUploadHandler);
 
@@ -371,7 +811,7 @@ void initWebServer() {
  * request to the Root endpoint.
 */
 void endpointHandlerRoot() {
-  String content = "";
+  PGM_P statusMsg = nullptr;
 
   // Handle incoming parameters...
   if (webServer.arg("source").equalsIgnoreCase("manualcontrols") && !settings.getIsAutoControl()) { // <----------------------- AutoControl is OFF...
@@ -397,9 +837,16 @@ void endpointHandlerRoot() {
       settings.setIsAutoControl(autoControl.equalsIgnoreCase("enabled"));
       wasUpdate = true;
     }
-    if (!desiredTemp.isEmpty() && !tempPadding.isEmpty()) {
-      settings.setDesiredTemp(desiredTemp.toFloat());
-      settings.setTempPadding(tempPadding.toFloat());
+    int16_t desiredCenti = 0;
+    int16_t paddingCenti = 0;
+    if (
+      CentiTemp::parse(desiredTemp.c_str(), desiredCenti)
+      && CentiTemp::parse(tempPadding.c_str(), paddingCenti)
+      && desiredCenti >= -10000 && desiredCenti <= 10000
+      && paddingCenti >= 0 && paddingCenti <= 10000
+    ) {
+      settings.setDesiredTempCenti(desiredCenti);
+      settings.setTempPaddingCenti(paddingCenti);
       wasUpdate = true;
     }
 
@@ -408,44 +855,394 @@ void endpointHandlerRoot() {
     }
 
     if (wasUpdate) {
-      if (updateSuccessful) {
-        content = content + String(UPDATE_SUCCESSFUL_MSG);
-      } else {
-        content = content + String(UPDATE_FAILED_MSG);
-      }
+      statusMsg = (updateSuccessful ? UPDATE_SUCCESSFUL_MSG : UPDATE_FAILED_MSG);
     }
   }
 
   // Build and send Information Page...
-  String tBudId = settings.getTempSensorIp();
-  bool tempBuddyEnabled = !tBudId.isEmpty() && !tBudId.equals("0.0.0.0");
-
-  String temp = INFO_PAGE;
-  temp.replace("${tempsensorip}", (!tempBuddyEnabled ? "Not Set" : String(settings.getTempSensorIp())));
-  temp.replace("${lastknowntemp}", (!tempBuddyEnabled ? "N/A" : String(settings.getLastKnownTemp())));
-  temp.replace("${controltype}", (settings.getIsHeat() ? "Heat" : "Cool"));
-  temp.replace("${autocontrolenabled}", (settings.getIsAutoControl() ? "True" : "False"));
-  temp.replace("${deviceonstatus}", (settings.getIsControlOn() ? "ON" : "OFF"));
-  content.concat(temp);
-
-  // Only show Manual Controls if AutoControl is OFF...
-  bool isAutoCtrl = settings.getIsAutoControl();
-  String result = "";
-  if (!isAutoCtrl) { // AutoControl is OFF...
-    String buddySensorIp = settings.getTempSensorIp();
-    if (buddySensorIp.isEmpty() || buddySensorIp.equals("0.0.0.0")) {
-      content = content + String(MANUAL_CONTROLS_ONLY_SECTION);
+  bool tempBuddyEnabled = settings.isTempSensorSet();
+
+  ContentWriter contentWriter = [statusMsg, tempBuddyEnabled]() {
+    if (statusMsg != nullptr) { // An update was attempted...
+      responseWriter.print(FPSTR(statusMsg));
+    }
+
+    writeTemplate_P(INFO_PAGE, INFO_PAGE_INDEX.segments, [tempBuddyEnabled](Placeholder placeholder) {
+      switch (placeholder) {
+        case Placeholder::TEMPSENSORIP:
+          if (!tempBuddyEnabled) { // No sensor...
+            responseWriter.print(F("Not Set"));
+          } else {
+            bool first = true;
+            for (uint8_t i = 0U; i < TEMP_SENSOR_MAX_COUNT; i++) {
+              const char *sensorHost = settings.getTempSensorHostCStr(i);
+              if (sensorHost[0] == '\0') { // Not in use...
+
+                continue;
+              }
+              if (!first) {
+                responseWriter.print(F(", "));
+              }
+              responseWriter.print(sensorHost);
+              first = false;
+            }
+          }
+          break;
+        case Placeholder::LASTKNOWNTEMP:
+          if (!tempBuddyEnabled) { // No sensor...
+            responseWriter.print(F("N/A"));
+          } else {
+            printTemp(settings.getLastKnownTempCenti());
+          }
+          break;
+        case Placeholder::CONTROLTYPE:
+          responseWriter.print(settings.getIsHeat() ? F("Heat") : F("Cool"));
+          break;
+        case Placeholder::AUTOCONTROLENABLED:
+          responseWriter.print(settings.getIsAutoControl() ? F("True") : F("False"));
+          break;
+        case Placeholder::DEVICEONSTATUS:
+          responseWriter.print(digitalRead(OUTLET_PIN) == HIGH ? F("ON") : F("OFF"));
+          if (relayGuard.getHold() != RelayGuard::NONE) { // Being kept from switching...
+            responseWriter.printf_P(
+              PSTR(" (turning %s in %lus)"),
+              (settings.getIsControlOn() ? "ON" : "OFF"),
+              (relayGuard.getHoldMillis(millis()) + 999UL) / 1000UL
+            );
+          }
+          break;
+        default:
+          break;
+      }
+    });
+
+    // Only show Manual Controls if AutoControl is OFF...
+    if (!settings.getIsAutoControl()) { // AutoControl is OFF...
+      responseWriter.print(!tempBuddyEnabled ? FPSTR(MANUAL_CONTROLS_ONLY_SECTION) : FPSTR(MANUAL_CONTROLS_SECTION));
+    } else { // AutoControl is ON...
+      writeTemplate_P(AUTO_CONTROLS_SECTION, AUTO_CONTROLS_SECTION_INDEX.segments, [](Placeholder placeholder) {
+        switch (placeholder) {
+          case Placeholder::DESIREDTEMP:
+            printTemp(settings.getDesiredTempCenti());
+            break;
+          case Placeholder::TEMPPADDING:
+            printTemp(settings.getTempPaddingCenti());
+            break;
+          default:
+            break;
+        }
+      });
+    }
+  };
+
+  if (statusMsg != nullptr || !webServer.arg("source").isEmpty()) { // Page reflects a form submission...
+    sendHtmlPageUsingTemplate(200, settings.getTitle(), settings.getHeading(), contentWriter);
+
+    return;
+  }
+
+  // FYI: The countdown shown while the outlet is held changes every second without the state
+  // version changing, so the page is neither cached nor tagged until the hold ends...
+  if (relayGuard.getHold() != RelayGuard::NONE) { // Outlet is being held...
+    webServer.sendHeader(F("Cache-Control"), F("no-store"));
+    sendHtmlPageUsingTemplate(200, settings.getTitle(), settings.getHeading(), contentWriter);
+
+    return;
+  }
+
+  if (handleStateConditionalGet()) { // Client is up to date...
+
+    return;
+  }
+
+  if (cachedInfoPage.isEmpty() || cachedInfoPageVersion != settings.getStateVersion()) { // Cached page is stale...
+    cachedInfoPage = "";
+    if (cachedInfoPage.reserve(INFO_PAGE_CACHE_RESERVE)) { // Room to cache the page...
+      responseWriter.begin([](const char *data, size_t length) { cachedInfoPage.concat(data, length); });
+      writeHtmlPage(settings.getTitle(), settings.getHeading(), contentWriter, emptyString, 0);
+      responseWriter.end();
+      cachedInfoPageVersion = settings.getStateVersion();
+    } else { // Memory is tight so don't hold onto the page...
+      cachedInfoPage = String();
+      sendHtmlPageUsingTemplate(200, settings.getTitle(), settings.getHeading(), contentWriter);
+
+      return;
+    }
+  }
+
+  webServer.send(200, "text/html", cachedInfoPage);
+}
+
+/**
+ * #### ENDPOINT HANDLER ("/api/status") ####
+ * This is the handler for the status API. It answers with the device's current
+ * state as a small JSON document that is serialized straight into the response
+ * rather than into an intermediate String first. There is no ETag as much of
+ * the document, such as uptime, counters and sensor age, changes without any
+ * setting changing.
+*/
+void endpointHandlerApiStatus() {
+  webServer.sendHeader(F("Cache-Control"), F("no-store"));
+
+  JsonDocument doc;
+  setJsonTemp(doc["last_known_temp"].to<JsonVariant>(), settings.getLastKnownTempCenti());
+  setJsonTemp(doc["desired_temp"].to<JsonVariant>(), settings.getDesiredTempCenti());
+  setJsonTemp(doc["temp_padding"].to<JsonVariant>(), settings.getTempPaddingCenti());
+  doc["is_heat"] = settings.getIsHeat();
+  doc["is_auto_control"] = settings.getIsAutoControl();
+  doc["is_control_on"] = settings.getIsControlOn();
+  doc["uptime_sec"] = millis() / 1000UL;
+  if (lastSuccessfulTempRead == 0UL) { // Sensor has never been read...
+    doc["sensor_age_sec"] = nullptr;
+  } else {
+    doc["sensor_age_sec"] = (millis() - lastSuccessfulTempRead) / 1000UL;
+  }
+  JsonObject tls = doc["tls_sessions"].to<JsonObject>();
+  tls["size"] = tlsSessionCache.getSize();
+  tls["resumed"] = tlsSessionCache.getResumedCount();
+  tls["full"] = tlsSessionCache.getFullCount();
+  tls["evictions"] = tlsSessionCache.getEvictionCount();
+  doc["poll_interval_sec"] = pollInterval.getInterval() / 1000UL;
+  doc["temp_rate_per_min"] = pollInterval.getRatePerMin();
+  JsonObject udp = doc["udp"].to<JsonObject>();
+  udp["port"] = udpTelemetry.getPort();
+  udp["accepted"] = udpTelemetry.getAcceptedCount();
+  udp["bad_mac"] = udpTelemetry.getBadMacCount();
+  udp["replayed"] = udpTelemetry.getReplayedCount();
+  udp["malformed"] = udpTelemetry.getMalformedCount();
+  udp["beacons"] = udpTelemetry.getBeaconCount();
+  JsonObject resolver = doc["resolver"].to<JsonObject>();
+  resolver["lookups"] = hostResolver.getLookupCount();
+  resolver["failed_lookups"] = hostResolver.getFailedLookupCount();
+  resolver["found_sensors"] = hostResolver.getFoundCount();
+  doc["idle_ms"] = scheduler.getIdleMillis();
+  JsonArray tasks = doc["tasks"].to<JsonArray>();
+  for (uint8_t i = 0U; i < scheduler.getTaskCount(); i++) {
+    JsonObject task = tasks.add<JsonObject>();
+    task["name"] = scheduler.getTaskName(i);
+    task["priority"] = CoopScheduler::getPriorityName(scheduler.getTaskPriority(i));
+    task["period_ms"] = scheduler.getTaskPeriodMillis(i);
+    task["runs"] = scheduler.getTaskRunCount(i);
+    task["overruns"] = scheduler.getTaskOverrunCount(i);
+    task["skipped"] = scheduler.getTaskSkipCount(i);
+    task["worst_us"] = scheduler.getTaskWorstMicros(i);
+    task["last_us"] = scheduler.getTaskLastMicros(i);
+  }
+  doc["aggregation"] = TempAggregator::getPolicyName((TempAggregator::Policy) settings.getAggregationPolicy());
+  JsonObject failSafe = doc["fail_safe"].to<JsonObject>();
+  failSafe["policy"] = FAIL_SAFE_POLICY_NAMES[settings.getFailSafePolicy()];
+  failSafe["after_sec"] = settings.getFailSafeAfterSec();
+  failSafe["active"] = failSafeActive && settings.getIsAutoControl() && settings.isTempSensorSet();
+  JsonObject relay = doc["relay"].to<JsonObject>();
+  relay["is_on"] = digitalRead(OUTLET_PIN) == HIGH;
+  relay["hold"] = RelayGuard::getHoldName(relayGuard.getHold());
+  relay["hold_sec"] = (relayGuard.getHoldMillis(millis()) + 999UL) / 1000UL;
+  relay["holds"] = relayGuard.getHoldCount();
+  relay["cycles_last_hour"] = relayGuard.getCyclesInLastHour(millis());
+  relay["toggles"] = relayGuard.getToggleCount();
+  relay["total_toggles"] = settings.getRelayToggleTotal() + (relayGuard.getToggleCount() - foldedRelayToggles);
+  JsonObject control = doc["control"].to<JsonObject>();
+  control["mode"] = CONTROL_MODE_NAMES[settings.getControlMode()];
+  setJsonNumber(control["output"].to<JsonVariant>(), pidController.getOutput(), 3U);
+  control["window_sec"] = settings.getPidWindowSec();
+  JsonObject tune = control["autotune"].to<JsonObject>();
+  tune["state"] = RelayAutoTune::getStateName(autoTune.getState());
+  tune["cycles"] = autoTune.getCycleCount();
+  JsonObject modeCycles = control["cycles"].to<JsonObject>();
+  for (uint8_t i = CONTROL_HYSTERESIS; i <= CONTROL_PID; i++) {
+    JsonObject mode = modeCycles[CONTROL_MODE_NAMES[i]].to<JsonObject>();
+    float hours = controlModeMillis[i] / 3600000.0;
+    mode["cycles"] = controlModeCycles[i];
+    setJsonNumber(mode["hours"].to<JsonVariant>(), hours, 2U);
+    if (hours > 0.0) {
+      setJsonNumber(mode["per_hour"].to<JsonVariant>(), controlModeCycles[i] / hours, 2U);
+    } else { // Mode hasn't been in charge yet...
+      mode["per_hour"] = nullptr;
+    }
+  }
+  JsonArray sensors = doc["sensors"].to<JsonArray>();
+  for (uint8_t i = 0U; i < TEMP_SENSOR_MAX_COUNT; i++) {
+    SensorClient &client = sensorClients[i];
+    if (client.getHost().isEmpty()) { // Sensor not in use...
+
+      continue;
+    }
+
+    JsonObject sensor = sensors.add<JsonObject>();
+    sensor["host"] = client.getHost();
+    if (client.getAddress().isSet()) {
+      sensor["address"] = client.getAddress().toString();
+    } else { // Not resolved yet...
+      sensor["address"] = nullptr;
+    }
+    if (sensorReadings[i].hasReading) {
+      setJsonTemp(sensor["temp"].to<JsonVariant>(), sensorReadings[i].centiF);
+      sensor["age_sec"] = (millis() - sensorReadings[i].readAt) / 1000UL;
+      sensor["latency_ms"] = client.getLastLatencyMillis();
+    } else { // Sensor has never been read...
+      sensor["temp"] = nullptr;
+      sensor["age_sec"] = nullptr;
+      sensor["latency_ms"] = nullptr;
+    }
+    sensor["used"] = sensorReadings[i].used;
+    if (sensorPushedAt[i] == 0UL) { // Sensor has never pushed...
+      sensor["pushed_age_sec"] = nullptr;
+    } else {
+      sensor["pushed_age_sec"] = (millis() - sensorPushedAt[i]) / 1000UL;
+    }
+    sensor["handshake_ms"] = client.getLastHandshakeMillis();
+    sensor["resumed"] = client.getLastResumed();
+    sensor["reused_connection"] = client.getLastReused();
+    sensor["handshakes"] = client.getHandshakeCount();
+    sensor["resumed_handshakes"] = client.getResumedCount();
+    if (isnan(client.getLastHumidity())) { // Sensor doesn't report humidity...
+      sensor["humidity"] = nullptr;
     } else {
-      content = content + String(MANUAL_CONTROLS_SECTION);
+      setJsonNumber(sensor["humidity"].to<JsonVariant>(), client.getLastHumidity(), 1U);
     }
-  } else { // AutoControl is ON...
-    String temp = String(AUTO_CONTROLS_SECTION);
-    temp.replace("${desiredtemp}", String(settings.getDesiredTemp()));
-    temp.replace("${temppadding}", String(settings.getTempPadding()));
-    content = content + temp;
+    sensor["phase"] = SensorClient::getPhaseName(client.getPhase());
+    sensor["failures"] = client.getFailureCount();
+    if (client.getFailureCount() == 0UL) { // No read has failed...
+      sensor["last_failed_phase"] = nullptr;
+    } else {
+      sensor["last_failed_phase"] = SensorClient::getPhaseName(client.getLastFailedPhase());
+    }
+    JsonObject breaker = sensor["breaker"].to<JsonObject>();
+    breaker["state"] = CircuitBreaker::getStateName(client.getBreakerState());
+    breaker["consecutive_failures"] = client.getConsecutiveFailures();
+    breaker["retry_in_sec"] = (client.getRetryInMillis() + 999UL) / 1000UL;
+    breaker["trips"] = client.getBreakerTripCount();
   }
 
-  sendHtmlPageUsingTemplate(200, settings.getTitle(), settings.getHeading(), content);
+  beginResponse(200, "application/json", measureJson(doc));
+  serializeJson(doc, responseWriter);
+  endResponse();
+}
+
+/**
+ * #### ENDPOINT HANDLER ("/style.css") ####
+ * This is the handler for the pages' style sheet. The style sheet is minified
+ * and gzipped at build time, see scripts/build_assets.py, so it is sent as is
+ * from PROGMEM. Pages link to it by version so it can be cached for a long time.
+*/
+void endpointHandlerStyle() {
+  webServer.sendHeader(F("ETag"), F(STYLE_CSS_ETAG));
+  webServer.sendHeader(F("Cache-Control"), F("public, max-age=31536000, immutable"));
+  if (webServer.header(F("If-None-Match")).equals(F(STYLE_CSS_ETAG))) { // Client is up to date...
+    webServer.send(304);
+
+    return;
+  }
+
+  webServer.sendHeader(F("Content-Encoding"), F("gzip"));
+  webServer.send_P(200, PSTR("text/css"), (PGM_P) STYLE_CSS_GZ, STYLE_CSS_GZ_LENGTH);
+}
+
+/**
+ * #### ENDPOINT HANDLER ("/api/events") ####
+ * This is the handler for the Server-Sent Events stream. The client's connection
+ * is kept open and handed to the eventStream, which pushes a "state" event to it
+ * each time the last known temperature or the outlet state changes.
+*/
+void endpointHandlerApiEvents() {
+  char data[96];
+  buildLiveStateEvent(data, sizeof(data));
+  if (!eventStream.subscribe(webServer.client(), "state", data)) { // No room for another subscriber...
+    webServer.send(503, "text/plain", F("Too many event subscribers, try again later."));
+  }
+}
+
+/**
+ * #### ENDPOINT HANDLER ("/api/push") ####
+ * This is the handler that lets a TempBuddy Sensor push a reading instead of waiting to be
+ * polled. The sensor must send the push key set on the admin page as a bearer token, and a
+ * compact JSON body such as {"temp":71.6,"temp_unit":"F"}. The sensor is matched by its IP
+ * against the configured sensors, or by the 0 based "sensor" index in the body if it can't
+ * be. The reading goes straight into the last known temperature and the outlet is acted on
+ * right away. A sensor that is pushing isn't polled until its pushes go stale.
+*/
+void endpointHandlerApiPush() {
+  const char *pushKey = settings.getPushKeyCStr();
+  if (pushKey[0] == '\0') { // Push hasn't been enabled...
+    webServer.send(403, "text/plain", F("Push is disabled."));
+
+    return;
+  }
+  if (!pushKeyMatches(webServer.header("Authorization"), pushKey)) { // Not authorized...
+    webServer.send(401, "text/plain", F("Bad push key."));
+
+    return;
+  }
+
+  JsonDocument reading;
+  if (deserializeJson(reading, webServer.arg("plain"))) { // Not JSON...
+    webServer.send(400, "text/plain", F("Body must be JSON."));
+
+    return;
+  }
+  int16_t centiF = 0;
+  if (!SensorClient::decodeTemp(reading["temp"], reading["temp_unit"], centiF)) { // Not a reading...
+    webServer.send(400, "text/plain", F("Body must have temp and temp_unit."));
+
+    return;
+  }
+
+  // Work out which sensor this is...
+  int index = -1;
+  IPAddress remoteIp = webServer.client().remoteIP();
+  IPAddress sensorIp;
+  for (uint8_t i = 0U; i < TEMP_SENSOR_MAX_COUNT && index < 0; i++) {
+    if (
+      settings.isTempSensorSet(i)
+      && (
+        (sensorIp.fromString(settings.getTempSensorHostCStr(i)) && sensorIp == remoteIp)
+        || sensorClients[i].getAddress() == remoteIp
+      )
+    ) { // FYI: A sensor set by name is known by the address it was last resolved to
+      index = i;
+    }
+  }
+  if (index < 0 && reading["sensor"].is<int>()) { // Sensor says which it is...
+    int given = reading["sensor"];
+    if (given >= 0 && given < (int) TEMP_SENSOR_MAX_COUNT && settings.isTempSensorSet((uint8_t) given)) {
+      index = given;
+    }
+  }
+  if (index < 0) { // Not a configured sensor...
+    webServer.send(400, "text/plain", F("Unknown sensor."));
+
+    return;
+  }
+
+  recordPushedReading((uint8_t) index, centiF);
+
+  webServer.send(204);
+}
+
+/**
+ * Used to check the Authorization header of a push against the push key. The
+ * comparison takes the same time no matter where the key differs.
+ *
+ * @param authorization The value of the Authorization header as String.
+ * @param pushKey The push key as char pointer.
+ *
+ * @return Returns true if the header holds the push key otherwise false as bool.
+*/
+bool pushKeyMatches(const String &authorization, const char *pushKey) {
+  if (!authorization.startsWith(F("Bearer "))) { // Not a bearer token...
+
+    return false;
+  }
+
+  const char *given = authorization.c_str() + 7;
+  size_t givenLength = authorization.length() - 7;
+  size_t keyLength = strlen(pushKey);
+  uint8_t diff = (givenLength != keyLength ? 1U : 0U);
+  for (size_t i = 0U; i < keyLength; i++) {
+    diff |= (uint8_t) ((i < givenLength ? given[i] : 0) ^ pushKey[i]);
+  }
+
+  return diff == 0U;
 }
 
 bool adminPageSettingsUpdater() {
@@ -454,13 +1251,28 @@ bool adminPageSettingsUpdater() {
   String pwd = webServer.arg("pwd");
   String title = webServer.arg("title");
   String heading = webServer.arg("heading");
-  String sensorIp = webServer.arg("sensorip");
+  String sensorHost = webServer.arg("sensorip");
   String isAutoCtrl = webServer.arg("autocontrol");
   String isHeat = webServer.arg("controltype");
   String desiredTemp = webServer.arg("desiredtemp");
   String tempPadding = webServer.arg("temppadding");
   String adminUser = webServer.arg("adminuser");
   String adminPwd = webServer.arg("adminpwd");
+  String tlsCacheSize = webServer.arg("tlscachesize");
+  String aggregation = webServer.arg("aggregation");
+  String pollFloor = webServer.arg("pollfloor");
+  String pollCeiling = webServer.arg("pollceiling");
+  String pushKey = webServer.arg("pushkey");
+  String udpPort = webServer.arg("udpport");
+  String connectTimeout = webServer.arg("connecttimeout");
+  String readTimeout = webServer.arg("readtimeout");
+  String failSafe = webServer.arg("failsafe");
+  String failSafeAfter = webServer.arg("failsafeafter");
+  String controlMode = webServer.arg("controlmode");
+  String pidWindow = webServer.arg("pidwindow");
+  String pidKp = webServer.arg("pidkp");
+  String pidKi = webServer.arg("pidki");
+  String pidKd = webServer.arg("pidkd");
 
   bool changeRequiresReboot = false; // True if a change was made which will require a reboot to implement.
 
@@ -489,27 +1301,133 @@ bool adminPageSettingsUpdater() {
   } else if (isHeat.equals("cool")) {
     settings.setIsHeat(false);
   }
-  float fTemp = 0;
+  int16_t centiTemp = 0;
   if (
-    !desiredTemp.isEmpty()
-    && (fTemp = desiredTemp.toFloat()) >= -100.0
-    && fTemp <= 100.0
+    CentiTemp::parse(desiredTemp.c_str(), centiTemp)
+    && centiTemp >= -10000
+    && centiTemp <= 10000
   ) { // <------------------------------------------------------------------ desiredTemp
-    settings.setDesiredTemp(fTemp);
+    settings.setDesiredTempCenti(centiTemp);
   }
-  if (sensorIp.isEmpty() || ParseUtils::validDotNotationIp(sensorIp)) { // <---- sensorIp
-    if (!sensorIp.isEmpty() && settings.getTempSensorIp().isEmpty()) {
+  if (sensorHost.isEmpty() || HostResolver::isValidHost(sensorHost)) { // <---- sensorHost
+    if (!sensorHost.isEmpty() && !settings.isTempSensorSet(0U)) {
       // FYI: This prevents inital action before first read
-      settings.setLastKnownTemp(settings.getDesiredTemp());
+      settings.setLastKnownTempCenti(settings.getDesiredTempCenti());
+    }
+    settings.setTempSensorHost(sensorHost.c_str());
+  }
+  for (uint8_t i = 1U; i < TEMP_SENSOR_MAX_COUNT; i++) { // <------------- additional sensorHosts
+    String argName = String(F("sensorip")) + String(i);
+    if (!webServer.hasArg(argName)) { // Not on the form...
+
+      continue;
+    }
+    String otherSensorHost = webServer.arg(argName);
+    if (otherSensorHost.isEmpty() || HostResolver::isValidHost(otherSensorHost)) {
+      settings.setTempSensorHost(i, otherSensorHost.c_str());
     }
-    settings.setTempSensorIp(sensorIp.c_str());
   }
+  long lFloor = settings.getPollFloorSec();
+  long lCeiling = settings.getPollCeilingSec();
   if (
-    !tempPadding.isEmpty()
-    && (fTemp = tempPadding.toFloat()) >= 0.0
-    && fTemp <= 100.0
+    (pollFloor.isEmpty() || parseFormLong(pollFloor, lFloor))
+    && (pollCeiling.isEmpty() || parseFormLong(pollCeiling, lCeiling))
+    && lFloor >= 5
+    && lFloor <= lCeiling
+    && lCeiling <= 3600
+  ) { // <------------------------------------------------------------------ pollFloor/pollCeiling
+    settings.setPollFloorSec((uint16_t) lFloor);
+    settings.setPollCeilingSec((uint16_t) lCeiling);
+  }
+  if (
+    webServer.hasArg("pushkey")
+    && pushKey.length() <= 32
+    && !pushKey.equals(settings.getPushKey())
+  ) { // <------------------------------------------------------------------ pushKey
+    if (settings.getUdpPort() != 0U) { // FYI: UDP telemetry takes its key at boot
+      changeRequiresReboot = true;
+    }
+    settings.setPushKey(pushKey.c_str());
+  }
+  long lTimeout = 0;
+  if (
+    parseFormLong(connectTimeout, lTimeout)
+    && lTimeout >= 500
+    && lTimeout <= 30000
+  ) { // <------------------------------------------------------------------ connectTimeout
+    settings.setSensorConnectTimeoutMs((uint16_t) lTimeout);
+  }
+  if (
+    parseFormLong(readTimeout, lTimeout)
+    && lTimeout >= 500
+    && lTimeout <= 30000
+  ) { // <------------------------------------------------------------------ readTimeout
+    settings.setSensorReadTimeoutMs((uint16_t) lTimeout);
+  }
+  for (uint8_t i = FAIL_SAFE_OFF; i <= FAIL_SAFE_HOLD; i++) { // <---------- failSafe
+    if (failSafe.equals(FAIL_SAFE_POLICY_NAMES[i])) {
+      settings.setFailSafePolicy(i);
+    }
+  }
+  if (
+    parseFormLong(failSafeAfter, lTimeout)
+    && lTimeout >= 0
+    && lTimeout <= 65535
+    && (lTimeout == 0 || lTimeout >= 60)
+  ) { // <------------------------------------------------------------------ failSafeAfter
+    settings.setFailSafeAfterSec((uint16_t) lTimeout);
+  }
+  for (uint8_t i = CONTROL_HYSTERESIS; i <= CONTROL_PID; i++) { // <-------- controlMode
+    if (controlMode.equals(CONTROL_MODE_NAMES[i])) {
+      settings.setControlMode(i);
+    }
+  }
+  if (
+    parseFormLong(pidWindow, lTimeout)
+    && lTimeout >= 60
+    && lTimeout <= 3600
+  ) { // <------------------------------------------------------------------ pidWindow
+    settings.setPidWindowSec((uint16_t) lTimeout);
+  }
+  float fKp = settings.getPidKp();
+  float fKi = settings.getPidKi();
+  float fKd = settings.getPidKd();
+  if (
+    (pidKp.isEmpty() || parseFormFloat(pidKp, fKp))
+    && (pidKi.isEmpty() || parseFormFloat(pidKi, fKi))
+    && (pidKd.isEmpty() || parseFormFloat(pidKd, fKd))
+    && fKp >= 0.0 && fKp <= 100.0
+    && fKi >= 0.0 && fKi <= 100.0
+    && fKd >= 0.0 && fKd <= 100.0
+  ) { // <------------------------------------------------------------------ pidKp/pidKi/pidKd
+    settings.setPidGains(fKp, fKi, fKd);
+  }
+  for (uint8_t i = 0U; i < 2U; i++) { // <--------------------------------- heat/cool relay limits
+    bool forHeat = (i == 0U);
+    String prefix = (forHeat ? F("heat") : F("cool"));
+    String minOn = webServer.arg(prefix + F("minon"));
+    String minOff = webServer.arg(prefix + F("minoff"));
+    String maxCycles = webServer.arg(prefix + F("maxcycles"));
+    if (parseFormLong(minOn, lTimeout) && lTimeout >= 0 && lTimeout <= 3600) {
+      settings.setMinOnSec(forHeat, (uint16_t) lTimeout);
+    }
+    if (parseFormLong(minOff, lTimeout) && lTimeout >= 0 && lTimeout <= 3600) {
+      settings.setMinOffSec(forHeat, (uint16_t) lTimeout);
+    }
+    if (parseFormLong(maxCycles, lTimeout) && lTimeout >= 0 && lTimeout <= RELAY_GUARD_MAX_CYCLES_PER_HOUR) {
+      settings.setMaxCyclesPerHour(forHeat, (uint8_t) lTimeout);
+    }
+  }
+  TempAggregator::Policy policy = TempAggregator::MEDIAN;
+  if (TempAggregator::parsePolicy(aggregation.c_str(), policy)) { // <------- aggregation
+    settings.setAggregationPolicy((uint8_t) policy);
+  }
+  if (
+    CentiTemp::parse(tempPadding.c_str(), centiTemp)
+    && centiTemp >= 0
+    && centiTemp <= 10000
   ) { // <------------------------------------------------------------------ tempPadding
-    settings.setTempPadding(fTemp);
+    settings.setTempPaddingCenti(centiTemp);
   }
   if (!adminUser.isEmpty() && adminUser.length() <= 12) { // <-------------- adminUser
     settings.setAdminUser(adminUser.c_str());
@@ -517,6 +1435,25 @@ bool adminPageSettingsUpdater() {
   if (!adminPwd.isEmpty() && adminPwd.length() <= 12) { // <---------------- adminPwd
     settings.setAdminPwd(adminPwd.c_str());
   }
+  long lSize = 0;
+  if (
+    parseFormLong(tlsCacheSize, lSize)
+    && lSize >= 1
+    && lSize <= TLS_SESSION_CACHE_MAX_SIZE
+    && lSize != settings.getTlsSessionCacheSize()
+  ) { // <------------------------------------------------------------------ tlsCacheSize
+    changeRequiresReboot = true;
+    settings.setTlsSessionCacheSize((uint8_t) lSize);
+  }
+  if (
+    parseFormLong(udpPort, lSize)
+    && lSize >= 0
+    && lSize <= 65535
+    && lSize != settings.getUdpPort()
+  ) { // <------------------------------------------------------------------ udpPort
+    changeRequiresReboot = true;
+    settings.setUdpPort((uint16_t) lSize);
+  }
 
   return changeRequiresReboot;
 }
@@ -532,33 +1469,59 @@ bool adminPageSettingsUpdater() {
 void endpointHandlerAdmin() {
 /* Ensure user authenticated */
 Serial.println(F("Client requested access to '/admin'."));
-if (!webServer.authenticate("admin", settings.getAdminPwd().c_str())) { // User not authenticated...
+if (!webServer.authenticate("admin", settings.getAdminPwdCStr())) { // User not authenticated...
   Serial.println(F("Client not(yet) Authenticated!"));
 
   return webServer.requestAuthentication(DIGEST_AUTH, "AdminRealm", "Authentication failed!");
 }
 Serial.println(F("Client has been Authenticated."));
 
-  String content = ADMIN_SETTINGS_PAGE;
+  String content = "";
   bool changeRequiresReboot = false;
 
-  // Insert data into page contents...
-  content.replace("${ssid}", settings.getSsid());
-  content.replace("${pwd}", settings.getPwd());
-  content.replace("${title}", settings.getTitle());
-  content.replace("${heading}", settings.getHeading());
-  content.replace("${sensorip}", settings.getTempSensorIp());
-  content.replace("${autocontrolenabledchecked}", settings.getIsAutoControl() ? "checked" : "");
-  content.replace("${autocontroldisabledchecked}", settings.getIsAutoControl() ? "" : "checked");
-  content.replace("${controllingheatchecked}", settings.getIsHeat() ? "checked" : "");
-  content.replace("${controllingcoolchecked}", settings.getIsHeat() ? "" : "checked");
-  content.replace("${desiredtemp}", String(settings.getDesiredTemp()));
-  content.replace("${temppadding}", String(settings.getTempPadding()));
-  content.replace("${adminuser}", settings.getAdminUser());
-  content.replace("${adminpwd}", settings.getAdminPwd());
+  if (webServer.arg("action").equals("browse")) { // Asked to look for sensors...
+    hostResolver.browse();
+    content = F("<div>Browsing for TempBuddy Sensors...</div><a href='/admin'><h4>Back</h4></a>");
+
+    sendHtmlPageUsingTemplate(
+      200,
+      settings.getTitle(),
+      F("Device Settings"),
+      content,
+      "/admin",
+      3
+    );
+    yield();
+
+    return;
+  }
+
+  if (webServer.arg("action").equals("autotune")) { // Asked to work out the PID gains...
+    if (!settings.getIsAutoControl() || !settings.isTempSensorSet()) { // Nothing to tune against...
+      content = F("<div>Auto-Tune needs Auto Control enabled and a TempBuddy Sensor set.</div><a href='/admin'><h4>Back</h4></a>");
+    } else if (failSafeActive) { // Readings can't be trusted...
+      content = F("<div>Auto-Tune can't start while the temp reading is stale.</div><a href='/admin'><h4>Back</h4></a>");
+    } else {
+      autoTune.start(CentiTemp::toFloat(settings.getDesiredTempCenti()), settings.getIsHeat(), millis());
+      content = F("<div>Auto-Tune started, it can take a few hours. The outlet will be switched fully on and off around the Desired Temp and PID control mode taken up when done.</div><a href='/admin'><h4>Back</h4></a>");
+    }
+
+    sendHtmlPageUsingTemplate(
+      200,
+      settings.getTitle(),
+      F("Device Settings"),
+      content,
+      "/admin",
+      10
+    );
+    yield();
+
+    return;
+  }
 
   if (webServer.arg("source").equalsIgnoreCase("settings")) { // Refered from settings page so do update...
     changeRequiresReboot = adminPageSettingsUpdater();
+    foldRelayToggles();
 
     /* ********************** *
      * Save Settings To NVRAM *
@@ -603,7 +1566,156 @@ Serial.println(F("Client has been Authenticated."));
     }
   }
 
-  sendHtmlPageUsingTemplate(200, settings.getTitle(), F("Device Settings"), content);
+  sendHtmlPageUsingTemplate(200, settings.getTitle(), F("Device Settings"), []() {
+    // Insert data into page contents...
+    writeTemplate_P(ADMIN_SETTINGS_PAGE, ADMIN_SETTINGS_PAGE_INDEX.segments, [](Placeholder placeholder) {
+      switch (placeholder) {
+        case Placeholder::SSID:
+          responseWriter.print(settings.getSsidCStr());
+          break;
+        case Placeholder::PWD:
+          responseWriter.print(settings.getPwdCStr());
+          break;
+        case Placeholder::TITLE:
+          responseWriter.print(settings.getTitleCStr());
+          break;
+        case Placeholder::HEADING:
+          responseWriter.print(settings.getHeadingCStr());
+          break;
+        case Placeholder::SENSORIP:
+          responseWriter.print(settings.getTempSensorHostCStr(0U));
+          break;
+        case Placeholder::AUTOCONTROLENABLEDCHECKED:
+          responseWriter.print(settings.getIsAutoControl() ? F("checked") : F(""));
+          break;
+        case Placeholder::AUTOCONTROLDISABLEDCHECKED:
+          responseWriter.print(settings.getIsAutoControl() ? F("") : F("checked"));
+          break;
+        case Placeholder::CONTROLLINGHEATCHECKED:
+          responseWriter.print(settings.getIsHeat() ? F("checked") : F(""));
+          break;
+        case Placeholder::CONTROLLINGCOOLCHECKED:
+          responseWriter.print(settings.getIsHeat() ? F("") : F("checked"));
+          break;
+        case Placeholder::DESIREDTEMP:
+          printTemp(settings.getDesiredTempCenti());
+          break;
+        case Placeholder::TEMPPADDING:
+          printTemp(settings.getTempPaddingCenti());
+          break;
+        case Placeholder::ADMINUSER:
+          responseWriter.print(settings.getAdminUserCStr());
+          break;
+        case Placeholder::ADMINPWD:
+          responseWriter.print(settings.getAdminPwdCStr());
+          break;
+        case Placeholder::TLSCACHESIZE:
+          responseWriter.print(settings.getTlsSessionCacheSize());
+          break;
+        case Placeholder::TLSCACHEMAX:
+          responseWriter.print(TLS_SESSION_CACHE_MAX_SIZE);
+          break;
+        case Placeholder::PUSHKEY:
+          responseWriter.print(settings.getPushKeyCStr());
+          break;
+        case Placeholder::UDPPORT:
+          responseWriter.print(settings.getUdpPort());
+          break;
+        case Placeholder::POLLFLOOR:
+          responseWriter.print(settings.getPollFloorSec());
+          break;
+        case Placeholder::POLLCEILING:
+          responseWriter.print(settings.getPollCeilingSec());
+          break;
+        case Placeholder::EXTRASENSORS:
+          for (uint8_t i = 1U; i < TEMP_SENSOR_MAX_COUNT; i++) {
+            responseWriter.printf_P(
+              PSTR("<tr><td>TempBuddy Sensor %u:</td><td><input maxlength=\"63\" type=\"text\" list=\"foundsensors\" value=\"%s\" name=\"sensorip%u\" id=\"sensorip%u\"></td></tr> "),
+              i + 1U,
+              settings.getTempSensorHostCStr(i),
+              i,
+              i
+            );
+          }
+          break;
+        case Placeholder::CONNECTTIMEOUT:
+          responseWriter.print(settings.getSensorConnectTimeoutMs());
+          break;
+        case Placeholder::READTIMEOUT:
+          responseWriter.print(settings.getSensorReadTimeoutMs());
+          break;
+        case Placeholder::FAILSAFEAFTER:
+          responseWriter.print(settings.getFailSafeAfterSec());
+          break;
+        case Placeholder::FAILSAFEOPTIONS:
+          for (uint8_t i = FAIL_SAFE_OFF; i <= FAIL_SAFE_HOLD; i++) {
+            responseWriter.printf_P(
+              PSTR("<option value=\"%s\"%s>%s</option>"),
+              FAIL_SAFE_POLICY_NAMES[i],
+              (settings.getFailSafePolicy() == i ? " selected" : ""),
+              FAIL_SAFE_POLICY_NAMES[i]
+            );
+          }
+          break;
+        case Placeholder::CONTROLMODEOPTIONS:
+          for (uint8_t i = CONTROL_HYSTERESIS; i <= CONTROL_PID; i++) {
+            responseWriter.printf_P(
+              PSTR("<option value=\"%s\"%s>%s</option>"),
+              CONTROL_MODE_NAMES[i],
+              (settings.getControlMode() == i ? " selected" : ""),
+              CONTROL_MODE_NAMES[i]
+            );
+          }
+          break;
+        case Placeholder::PIDWINDOW:
+          responseWriter.print(settings.getPidWindowSec());
+          break;
+        case Placeholder::PIDKP:
+          printNumber(settings.getPidKp(), 4U);
+          break;
+        case Placeholder::PIDKI:
+          printNumber(settings.getPidKi(), 4U);
+          break;
+        case Placeholder::PIDKD:
+          printNumber(settings.getPidKd(), 4U);
+          break;
+        case Placeholder::HEATMINON:
+          responseWriter.print(settings.getMinOnSec(true));
+          break;
+        case Placeholder::HEATMINOFF:
+          responseWriter.print(settings.getMinOffSec(true));
+          break;
+        case Placeholder::HEATMAXCYCLES:
+          responseWriter.print(settings.getMaxCyclesPerHour(true));
+          break;
+        case Placeholder::COOLMINON:
+          responseWriter.print(settings.getMinOnSec(false));
+          break;
+        case Placeholder::COOLMINOFF:
+          responseWriter.print(settings.getMinOffSec(false));
+          break;
+        case Placeholder::COOLMAXCYCLES:
+          responseWriter.print(settings.getMaxCyclesPerHour(false));
+          break;
+        case Placeholder::FOUNDSENSORS:
+          printFoundSensors();
+          break;
+        case Placeholder::AGGREGATIONOPTIONS:
+          for (uint8_t i = TempAggregator::MEDIAN; i <= TempAggregator::PRIMARY_FAILOVER; i++) {
+            const char *name = TempAggregator::getPolicyName((TempAggregator::Policy) i);
+            responseWriter.printf_P(
+              PSTR("<option value=\"%s\"%s>%s</option>"),
+              name,
+              (settings.getAggregationPolicy() == i ? " selected" : ""),
+              name
+            );
+          }
+          break;
+        default:
+          break;
+      }
+    });
+  });
 }
 
 /**
@@ -630,6 +1742,7 @@ void fileUploadHandler() {
  *
  * This function is used to Generate the HTML for a web page where the
  * title, heading and content is provided to the function as parameters.
+ * This is a convenience wrapper for content that is already held in a String.
  *
  * @param code The HTTP Code as int.
  * @param title The page's title as String.
@@ -641,28 +1754,277 @@ void fileUploadHandler() {
  * the client to the redirectUrl, as int.
 */
 void sendHtmlPageUsingTemplate(int code, String title, String heading, String &content, String  redirectUrl, int delaySeconds) {
-  String result = HTML_PAGE_TEMPLATE;
-  if (!result.reserve(6000U)) {
-    Serial.println(F("WARNING!!! htmlPageTemplate() failed to reserve desired memory!"));
+  sendHtmlPageUsingTemplate(code, title, heading, [&content]() { responseWriter.print(content); }, redirectUrl, delaySeconds);
+}
+
+/**
+ * #### HTML PAGE TEMPLATE ####
+ *
+ * This function is used to stream the HTML for a web page to the client where
+ * the title and heading are provided as parameters and the content is written
+ * by the given contentWriter as the template reaches its ${content} place-holder.
+ * The page is sent using chunked transfer encoding, so the memory used to send
+ * it is bounded by the ResponseWriter's buffer and not by the size of the page.
+ *
+ * @param code The HTTP Code as int.
+ * @param title The page's title as String.
+ * @param heading The heading that appears on the info page as String.
+ * @param contentWriter Function that writes the main content of the web page
+ * to the responseWriter, as ContentWriter.
+ * @param redirectUrl OPTIONAL PARAM, used to specify a page that this page should
+ * redirect to after a specified amount of time.
+ * @param delaySeconds OPTIONAL PARAM, the number of seconds to delay before sending
+ * the client to the redirectUrl, as int.
+*/
+void sendHtmlPageUsingTemplate(int code, const String &title, const String &heading, const ContentWriter &contentWriter, const String &redirectUrl, int delaySeconds) {
+  beginResponse(code, "text/html");
+  writeHtmlPage(title, heading, contentWriter, redirectUrl, delaySeconds);
+  endResponse();
+  yield();
+}
+
+/**
+ * Writes the HTML for a web page to the responseWriter, where the title and
+ * heading are provided as parameters and the content is written by the given
+ * contentWriter as the template reaches its ${content} place-holder.
+ *
+ * @param title The page's title as String.
+ * @param heading The heading that appears on the info page as String.
+ * @param contentWriter Function that writes the main content of the web page
+ * to the responseWriter, as ContentWriter.
+ * @param redirectUrl Page that this page should redirect to after delaySeconds,
+ * or empty for none, as String.
+ * @param delaySeconds The number of seconds to delay before sending the client
+ * to the redirectUrl, as int.
+*/
+void writeHtmlPage(const String &title, const String &heading, const ContentWriter &contentWriter, const String &redirectUrl, int delaySeconds) {
+  writeTemplate_P(HTML_PAGE_TEMPLATE, HTML_PAGE_TEMPLATE_INDEX.segments, [&](Placeholder placeholder) {
+    switch (placeholder) {
+      case Placeholder::TITLE:
+        responseWriter.print(title);
+        break;
+      case Placeholder::HEADING:
+        responseWriter.print(heading);
+        break;
+      case Placeholder::CONTENT:
+        contentWriter();
+        break;
+      case Placeholder::METAINSERT:
+        if (!redirectUrl.isEmpty()) { // A redirect was specified...
+          responseWriter.print(F("<meta http-equiv=\"refresh\" content=\""));
+          responseWriter.print(delaySeconds);
+          responseWriter.print(F("\"; URL=\""));
+          responseWriter.print(redirectUrl);
+          responseWriter.print(F("\" />"));
+        }
+        break;
+      default:
+        break;
+    }
+  });
+}
+
+/**
+ * Used to build the ETag for anything derived purely from the settings. The
+ * tag combines an ID chosen at boot with the settings' state version, so it
+ * changes whenever a setting may have changed and is never reused after a reboot.
+ *
+ * @return Returns the ETag, quotes included, as String.
+*/
+String getStateETag() {
+  char etag[24];
+  snprintf_P(etag, sizeof(etag), PSTR("\"%08lx-%lx\""), (unsigned long) bootId, settings.getStateVersion());
+
+  return String(etag);
+}
+
+/**
+ * Used to answer a conditional GET for something derived purely from the
+ * settings. The ETag header is added to the response and if the client
+ * already holds the current version a 304 is sent.
+ *
+ * @return Returns true if a 304 was sent and the request is complete,
+ * otherwise false as bool.
+*/
+bool handleStateConditionalGet() {
+  String etag = getStateETag();
+  webServer.sendHeader(F("ETag"), etag);
+  webServer.sendHeader(F("Cache-Control"), F("no-cache"));
+  if (webServer.method() == HTTP_GET && webServer.header(F("If-None-Match")).equals(etag)) { // Client is up to date...
+    webServer.send(304);
+
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * Starts a response. The headers are sent right away and everything written to
+ * the responseWriter afterwards is sent to the client until endResponse() is
+ * called. When the length of the content isn't known up front the response is
+ * sent using chunked transfer encoding.
+ *
+ * @param code The HTTP Code as int.
+ * @param contentType The value of the Content-Type header as char pointer.
+ * @param contentLength OPTIONAL PARAM, the length of the content if known as size_t.
+*/
+void beginResponse(int code, const char *contentType, size_t contentLength) {
+  webServer.setContentLength(contentLength);
+  webServer.send(code, contentType, emptyString);
+
+  responseWriter.begin(
+    [](const char *data, size_t length) { webServer.sendContent(data, length); },
+    [](PGM_P data, size_t length) { webServer.sendContent_P(data, length); }
+  );
+}
+
+/**
+ * Finishes a response that was started with beginResponse(), sending what
+ * remains in the responseWriter followed by the terminating chunk if chunked.
+*/
+void endResponse() {
+  responseWriter.end();
+  webServer.sendContent(emptyString);
+}
+
+/**
+ * Writes the given PROGMEM template to the responseWriter using its compile time
+ * index, see HtmlTemplate.h. Each literal run of the template is written as is
+ * and the given handler is called for the place-holder that follows it, the
+ * handler is expected to write the place-holder's value to the responseWriter.
+ *
+ * @param tmpl The PROGMEM template to write as PGM_P.
+ * @param index The segments of the template's index as HtmlTemplate::Segment pointer.
+ * @param handler The function to call for each place-holder as PlaceholderHandler.
+*/
+void writeTemplate_P(PGM_P tmpl, const HtmlTemplate::Segment *index, const PlaceholderHandler &handler) {
+  HtmlTemplate::Segment segment;
+  do { // Iterate the segments of the template...
+    memcpy_P(&segment, index++, sizeof(segment));
+    responseWriter.write_P(tmpl + segment.offset, segment.length);
+    if (segment.placeholder != Placeholder::NONE) {
+      handler(segment.placeholder);
+    }
+  } while (segment.placeholder != Placeholder::NONE);
+}
+
+/**
+ * Used to write a temperature kept in hundredths of a degree to the responseWriter as a
+ * plain decimal, such as 71.6, without going through a float.
+ *
+ * @param centi The temperature in hundredths of a degree as int16_t.
+*/
+void printTemp(int16_t centi) {
+  char text[CENTI_TEMP_TEXT_SIZE];
+  responseWriter.write((const uint8_t*) text, CentiTemp::format(centi, text, sizeof(text)));
+}
+
+/**
+ * Used to write the TempBuddy Sensors found by mDNS to the responseWriter, as a datalist
+ * for the sensor host fields followed by a list of names and addresses. Any device on the
+ * LAN can answer the query, so only answers the HostResolver gives out as valid host names
+ * are written, which keeps markup out of the page.
+*/
+void printFoundSensors() {
+  responseWriter.print(F("<datalist id=\"foundsensors\">"));
+  for (uint32_t i = 0U; i < hostResolver.getFoundCount(); i++) {
+    String foundHost = hostResolver.getFoundHost(i);
+    if (!foundHost.isEmpty()) {
+      responseWriter.printf_P(PSTR("<option value=\"%s\">"), foundHost.c_str());
+    }
   }
+  responseWriter.print(F("</datalist>"));
 
-  // Prepare the contents of the HTML page...
-  result.replace("${title}", title);
-  result.replace("${heading}", heading);
-  result.replace("${content}", content);
+  bool isAnyFound = false;
+  for (uint32_t i = 0U; i < hostResolver.getFoundCount(); i++) {
+    String foundHost = hostResolver.getFoundHost(i);
+    if (foundHost.isEmpty()) { // No usable name...
 
-  if (redirectUrl.isEmpty()) { // No redirect URL was specified...
-    result.replace("${metainsert}", "");
-  } else { // A redirect was specified...
-    String temp = "<meta http-equiv=\"refresh\" content=\"";
-    temp = temp + String(delaySeconds);
-    temp = temp + "\"; URL=\"";
-    temp = temp + redirectUrl;
-    temp = temp + "\" />";
+      continue;
+    }
+    responseWriter.printf_P(
+      PSTR("%s%s (%s)"),
+      (isAnyFound ? ", " : ""),
+      foundHost.c_str(),
+      hostResolver.getFoundAddress(i).toString().c_str()
+    );
+    isAnyFound = true;
+  }
+  if (!isAnyFound) { // Nothing found yet...
+    responseWriter.print(F("None"));
+  }
+}
 
-    result.replace("${metainsert}",  temp);
+/**
+ * Used to set a JSON value to a temperature kept in hundredths of a degree, written as a
+ * plain decimal number without going through a float.
+ *
+ * @param target The JSON value to set as JsonVariant.
+ * @param centi The temperature in hundredths of a degree as int16_t.
+*/
+void setJsonTemp(JsonVariant target, int16_t centi) {
+  char text[CENTI_TEMP_TEXT_SIZE];
+  size_t length = CentiTemp::format(centi, text, sizeof(text));
+  target.set(serialized(text, length));
+}
+
+/**
+ * Used to write a number to the responseWriter as a decimal with the given decimal places
+ * without the float loop Print uses. Nothing is written if it isn't a number.
+ *
+ * @param value The number to write as float.
+ * @param decimals The decimal places to write as uint8_t.
+*/
+void printNumber(float value, uint8_t decimals) {
+  char text[PARSE_UTILS_NUMBER_TEXT_SIZE];
+  responseWriter.write((const uint8_t*) text, ParseUtils::formatFloat(value, decimals, false, text, sizeof(text)));
+}
+
+/**
+ * Used to set a JSON value to a number rounded to the given decimal places, trailing
+ * zeros left off, or to null if it isn't a number.
+ *
+ * @param target The JSON value to set as JsonVariant.
+ * @param value The number to set as float.
+ * @param decimals The decimal places to keep as uint8_t.
+*/
+void setJsonNumber(JsonVariant target, float value, uint8_t decimals) {
+  char text[PARSE_UTILS_NUMBER_TEXT_SIZE];
+  size_t length = ParseUtils::formatFloat(value, decimals, true, text, sizeof(text));
+  if (length == 0U) { // Not a number...
+    target.set(nullptr);
+
+    return;
   }
+  target.set(serialized(text, length));
+}
 
-  webServer.send(code, "text/html", result);
-  yield();
+/**
+ * Used to parse a form argument as a whole number. Unlike String::toInt() anything that
+ * isn't entirely a number, such as an empty argument or "12abc", is rejected rather than
+ * taken as zero or 12.
+ *
+ * @param arg The form argument as String reference.
+ * @param value Receives the number, only when it parsed, as long reference.
+ *
+ * @return Returns true if the argument was a number otherwise false as bool.
+*/
+bool parseFormLong(const String &arg, long &value) {
+
+  return ParseUtils::parseLong(arg.c_str(), arg.length(), value) == ParseUtils::NUMBER_OK;
+}
+
+/**
+ * Used to parse a form argument as a decimal number. Unlike String::toFloat() anything
+ * that isn't entirely a number is rejected rather than taken as zero.
+ *
+ * @param arg The form argument as String reference.
+ * @param value Receives the number, only when it parsed, as float reference.
+ *
+ * @return Returns true if the argument was a number otherwise false as bool.
+*/
+bool parseFormFloat(const String &arg, float &value) {
+
+  return ParseUtils::parseFloat(arg.c_str(), arg.length(), value) == ParseUtils::NUMBER_OK;
 }
@@ -0,0 +1,46 @@
+/*
+  ESP8266WiFi - A stand-in for the ESP8266 core's WiFi header, for the native
+  test env only. It gives what the libraries under test take from it, along
+  with the core's millis(), which reads nativeMillis so tests can set the time.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#ifndef ESP8266WiFi_h
+    #define ESP8266WiFi_h
+
+    #include <stdint.h>
+    #include <string.h>
+    #include "WString.h"
+
+    inline unsigned long nativeMillis = 0UL; // What millis() returns
+
+    inline unsigned long millis() { return nativeMillis; }
+
+    enum WiFiMode_t {
+        WIFI_OFF = 0,
+        WIFI_STA = 1,
+        WIFI_AP = 2,
+        WIFI_AP_STA = 3
+    };
+
+    class IPAddress {
+        public:
+            uint8_t octets[4];
+
+            IPAddress() : octets{0U, 0U, 0U, 0U} {}
+            IPAddress(uint8_t first, uint8_t second, uint8_t third, uint8_t fourth) : octets{first, second, third, fourth} {}
+
+            uint8_t operator[](int index) const { return octets[index]; }
+    };
+
+    class ESP8266WiFiClass {
+        public:
+            WiFiMode_t getMode() { return WIFI_STA; }
+            IPAddress broadcastIP() { return IPAddress(192, 168, 1, 255); }
+    };
+
+    inline ESP8266WiFiClass WiFi;
+
+#endif
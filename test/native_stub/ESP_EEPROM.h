@@ -0,0 +1,78 @@
+/*
+  ESP_EEPROM - A stand-in for the ESP_EEPROM library, for the native test env
+  only. The flash is a block of host memory that lasts for the run, so what is
+  committed can be read back after end() and begin() as on the unit. Like the
+  library, the size given to begin() is kept with what is committed, and a
+  begin() with any other size finds nothing stored.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#ifndef ESP_EEPROM_h
+    #define ESP_EEPROM_h
+
+    #include <stddef.h>
+    #include <stdint.h>
+    #include <string.h>
+    #include <vector>
+
+    class EEPROMClass {
+        private:
+            std::vector<uint8_t>  flash              ; // What was last committed
+            std::vector<uint8_t>  buffer             ; // What is worked on between begin() and end()
+            bool                  isStored           ; // False until something is committed
+            bool                  isFound            ; // True if begin() found something stored at its size
+
+        public:
+            EEPROMClass() : isStored(false), isFound(false) {}
+
+            void begin(size_t size) {
+                isFound = (isStored && flash.size() == size);
+                buffer.assign(size, 0xFF);
+                if (isFound) {
+                    buffer = flash;
+                }
+            }
+
+            int percentUsed() {
+
+                return (isFound ? (int) ((flash.size() * 100U) / 4096U) : -1);
+            }
+
+            template <typename T> T& get(int const address, T &value) {
+                memcpy((void*) &value, buffer.data() + address, sizeof(T));
+
+                return value;
+            }
+
+            template <typename T> const T& put(int const address, const T &value) {
+                memcpy(buffer.data() + address, (const void*) &value, sizeof(T));
+
+                return value;
+            }
+
+            bool commit() {
+                flash = buffer;
+                isStored = true;
+                isFound = true;
+
+                return true;
+            }
+
+            bool wipe() {
+                flash.clear();
+                isStored = false;
+                isFound = false;
+
+                return true;
+            }
+
+            void end() {
+                buffer.clear();
+            }
+    };
+
+    inline EEPROMClass EEPROM;
+
+#endif
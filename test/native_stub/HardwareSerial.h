@@ -0,0 +1,24 @@
+/*
+  HardwareSerial - A stand-in for the ESP8266 core's Serial, for the native
+  test env only. What is printed is thrown away.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#ifndef HardwareSerial_h
+    #define HardwareSerial_h
+
+    #include <stddef.h>
+
+    class HardwareSerial {
+        public:
+            template <typename T> size_t print(const T &value) { (void) value; return 0U; }
+            template <typename T> size_t println(const T &value) { (void) value; return 0U; }
+            size_t println() { return 0U; }
+            template <typename... Args> size_t printf(const char *format, Args... args) { (void) format; return sizeof...(args) * 0U; }
+    };
+
+    inline HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,48 @@
+/*
+  MD5Builder - A stand-in for the ESP8266 core's MD5Builder, for the native
+  test env only. It is not MD5, it gives 32 hex digits from a pair of 64 bit
+  FNV-1a hashes, which is all the settings sentinel needs on the host as it is
+  only ever compared with another hash made the same way.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#ifndef MD5Builder_h
+    #define MD5Builder_h
+
+    #include <stdint.h>
+    #include <stdio.h>
+    #include <WString.h>
+
+    class MD5Builder {
+        private:
+            uint64_t  high               ;
+            uint64_t  low                ;
+
+        public:
+            MD5Builder() : high(0ULL), low(0ULL) {}
+
+            void begin() {
+                high = 14695981039346656037ULL;
+                low = 1099511628211ULL;
+            }
+
+            void add(const String &str) {
+                for (size_t i = 0U; i < str.length(); i++) {
+                    high = (high ^ (uint8_t) str[i]) * 1099511628211ULL;
+                    low = (low ^ (uint8_t) str[i]) * 14029467366897019727ULL;
+                }
+            }
+
+            void calculate() {}
+
+            String toString() {
+                char text[33];
+                snprintf(text, sizeof(text), "%016llx%016llx", (unsigned long long) high, (unsigned long long) low);
+
+                return String(text);
+            }
+    };
+
+#endif
@@ -0,0 +1,104 @@
+/*
+  WString - A stand-in for the Arduino core's String, for the native test env
+  only. It keeps the libraries under test building on the host without the
+  ESP8266 core, so it has just the members they use, with the same meaning
+  as the core's String, on top of std::string.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#ifndef WString_h
+    #define WString_h
+
+    #include <math.h>
+    #include <stdio.h>
+    #include <stdlib.h>
+    #include <cmath>
+    #include <string>
+
+    // The core brings these in with Arduino.h, ParseUtils uses them bare...
+    using std::isinf;
+    using std::isnan;
+
+    #define F(string_literal) (string_literal)
+
+    class String : public std::string {
+        public:
+            String() {}
+            String(const char *str) : std::string(str == NULL ? "" : str) {}
+            String(const std::string &str) : std::string(str) {}
+            explicit String(char c) : std::string(1, c) {}
+            explicit String(unsigned char value) : std::string(std::to_string(value)) {}
+            explicit String(int value) : std::string(std::to_string(value)) {}
+            explicit String(unsigned int value) : std::string(std::to_string(value)) {}
+            explicit String(long value) : std::string(std::to_string(value)) {}
+            explicit String(unsigned long value) : std::string(std::to_string(value)) {}
+            explicit String(float value, unsigned char decimalPlaces = 2U) : String((double) value, decimalPlaces) {}
+
+            explicit String(double value, unsigned char decimalPlaces = 2U) {
+                char text[48];
+                snprintf(text, sizeof(text), "%.*f", (int) decimalPlaces, value);
+                assign(text);
+            }
+
+            char *begin() { return &(*this)[0]; }
+            char charAt(unsigned int index) const { return (index < length() ? (*this)[index] : '\0'); }
+            bool concat(const char *str, unsigned int len) { append(str, len); return true; }
+            bool concat(char c) { push_back(c); return true; }
+            bool concat(const char *str) { append(str); return true; }
+            bool concat(const String &str) { append(str); return true; }
+            bool equals(const String &str) const { return compare(str) == 0; }
+            bool isEmpty() const { return empty(); }
+            long toInt() const { return atol(c_str()); }
+
+            int indexOf(char c, unsigned int fromIndex = 0U) const {
+                size_t at = find(c, fromIndex);
+
+                return (at == npos ? -1 : (int) at);
+            }
+
+            int indexOf(const String &str, unsigned int fromIndex = 0U) const {
+                size_t at = find(str, fromIndex);
+
+                return (at == npos ? -1 : (int) at);
+            }
+
+            void remove(unsigned int index) {
+                if (index < length()) {
+                    resize(index);
+                }
+            }
+
+            void replace(const String &find, const String &replaceWith) {
+                if (find.empty()) {
+
+                    return;
+                }
+                size_t at = 0U;
+                while ((at = std::string::find(find, at)) != npos) {
+                    std::string::replace(at, find.length(), replaceWith);
+                    at += replaceWith.length();
+                }
+            }
+
+            String substring(unsigned int beginIndex) const {
+
+                return (beginIndex < length() ? String(substr(beginIndex)) : String());
+            }
+
+            String substring(unsigned int beginIndex, unsigned int endIndex) const {
+                if (beginIndex > endIndex) {
+                    unsigned int temp = endIndex;
+                    endIndex = beginIndex;
+                    beginIndex = temp;
+                }
+                if (beginIndex >= length()) {
+
+                    return String();
+                }
+
+                return String(substr(beginIndex, endIndex - beginIndex));
+            }
+    };
+#endif
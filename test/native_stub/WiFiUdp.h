@@ -0,0 +1,82 @@
+/*
+  WiFiUdp - A stand-in for the ESP8266 core's WiFiUDP, for the native test env
+  only. There is no socket: datagrams a test puts in WiFiUDP::inbound are
+  received in order and every datagram sent is kept in WiFiUDP::sent along
+  with where it was sent.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#ifndef WiFiUdp_h
+    #define WiFiUdp_h
+
+    #include <stdint.h>
+    #include <deque>
+    #include <vector>
+    #include "ESP8266WiFi.h"
+
+    class WiFiUDP {
+        public:
+            struct Datagram {
+                IPAddress              ip        ;
+                uint16_t               port      ;
+                std::vector<uint8_t>   data      ;
+            };
+
+            static inline std::deque<std::vector<uint8_t>> inbound; // Waiting to be received
+            static inline std::vector<Datagram> sent; // Sent so far
+
+        private:
+            std::vector<uint8_t> current; // The datagram being read
+            Datagram outgoing; // The datagram being written
+
+        public:
+            uint8_t begin(uint16_t port) { (void) port; return 1U; }
+
+            int parsePacket() {
+                current.clear();
+                if (inbound.empty()) {
+
+                    return 0;
+                }
+                current = inbound.front();
+                inbound.pop_front();
+
+                return (int) current.size();
+            }
+
+            int read(uint8_t *buffer, size_t length) {
+                size_t count = (length < current.size() ? length : current.size());
+                memcpy(buffer, current.data(), count);
+                current.erase(current.begin(), current.begin() + count);
+
+                return (int) count;
+            }
+
+            void flush() { current.clear(); }
+
+            int beginPacket(IPAddress ip, uint16_t port) {
+                outgoing.ip = ip;
+                outgoing.port = port;
+                outgoing.data.clear();
+
+                return 1;
+            }
+
+            size_t write(const uint8_t *buffer, size_t size) {
+                size_t at = outgoing.data.size();
+                outgoing.data.resize(at + size);
+                memcpy(outgoing.data.data() + at, buffer, size);
+
+                return size;
+            }
+
+            int endPacket() {
+                sent.push_back(outgoing);
+
+                return 1;
+            }
+    };
+
+#endif
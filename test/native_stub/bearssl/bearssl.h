@@ -0,0 +1,179 @@
+/*
+  bearssl - A stand-in for the BearSSL HMAC API the ESP8266 core ships, for the
+  native test env only. It has just HMAC over SHA-256, which is all the
+  libraries under test use, with the same calls and results as BearSSL.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#ifndef BR_BEARSSL_H__
+    #define BR_BEARSSL_H__
+
+    #include <stddef.h>
+    #include <stdint.h>
+    #include <string.h>
+
+    #define BR_SHA256_BLOCK_SIZE 64U
+    #define BR_SHA256_SIZE 32U
+
+    typedef struct {
+        uint32_t   state   [8]                      ;
+        uint8_t    block   [BR_SHA256_BLOCK_SIZE]   ;
+        uint64_t   count                            ;
+    } br_sha256_context;
+
+    typedef struct {
+        int   id   ; // Only SHA-256 is here
+    } br_hash_class;
+
+    inline const br_hash_class br_sha256_vtable = { 4 };
+
+    typedef struct {
+        uint8_t   key   [BR_SHA256_BLOCK_SIZE]   ;
+    } br_hmac_key_context;
+
+    typedef struct {
+        br_sha256_context   inner                                ;
+        uint8_t             key         [BR_SHA256_BLOCK_SIZE]   ;
+        size_t              outLength                            ;
+    } br_hmac_context;
+
+    inline void br_sha256_init(br_sha256_context *context) {
+        static const uint32_t initial[8] = {
+            0x6a09e667U, 0xbb67ae85U, 0x3c6ef372U, 0xa54ff53aU, 0x510e527fU, 0x9b05688cU, 0x1f83d9abU, 0x5be0cd19U
+        };
+        memcpy(context->state, initial, sizeof(initial));
+        context->count = 0U;
+    }
+
+    inline void br_sha256_round(uint32_t *state, const uint8_t *block) {
+        static const uint32_t k[64] = {
+            0x428a2f98U, 0x71374491U, 0xb5c0fbcfU, 0xe9b5dba5U, 0x3956c25bU, 0x59f111f1U, 0x923f82a4U, 0xab1c5ed5U,
+            0xd807aa98U, 0x12835b01U, 0x243185beU, 0x550c7dc3U, 0x72be5d74U, 0x80deb1feU, 0x9bdc06a7U, 0xc19bf174U,
+            0xe49b69c1U, 0xefbe4786U, 0x0fc19dc6U, 0x240ca1ccU, 0x2de92c6fU, 0x4a7484aaU, 0x5cb0a9dcU, 0x76f988daU,
+            0x983e5152U, 0xa831c66dU, 0xb00327c8U, 0xbf597fc7U, 0xc6e00bf3U, 0xd5a79147U, 0x06ca6351U, 0x14292967U,
+            0x27b70a85U, 0x2e1b2138U, 0x4d2c6dfcU, 0x53380d13U, 0x650a7354U, 0x766a0abbU, 0x81c2c92eU, 0x92722c85U,
+            0xa2bfe8a1U, 0xa81a664bU, 0xc24b8b70U, 0xc76c51a3U, 0xd192e819U, 0xd6990624U, 0xf40e3585U, 0x106aa070U,
+            0x19a4c116U, 0x1e376c08U, 0x2748774cU, 0x34b0bcb5U, 0x391c0cb3U, 0x4ed8aa4aU, 0x5b9cca4fU, 0x682e6ff3U,
+            0x748f82eeU, 0x78a5636fU, 0x84c87814U, 0x8cc70208U, 0x90befffaU, 0xa4506cebU, 0xbef9a3f7U, 0xc67178f2U
+        };
+        auto rotr = [](uint32_t value, unsigned int bits) { return (value >> bits) | (value << (32U - bits)); };
+
+        uint32_t w[64];
+        for (unsigned int i = 0U; i < 16U; i++) {
+            w[i] = ((uint32_t) block[i * 4U] << 24) | ((uint32_t) block[i * 4U + 1U] << 16) | ((uint32_t) block[i * 4U + 2U] << 8) | block[i * 4U + 3U];
+        }
+        for (unsigned int i = 16U; i < 64U; i++) {
+            uint32_t s0 = rotr(w[i - 15U], 7U) ^ rotr(w[i - 15U], 18U) ^ (w[i - 15U] >> 3);
+            uint32_t s1 = rotr(w[i - 2U], 17U) ^ rotr(w[i - 2U], 19U) ^ (w[i - 2U] >> 10);
+            w[i] = w[i - 16U] + s0 + w[i - 7U] + s1;
+        }
+
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4], f = state[5], g = state[6], h = state[7];
+        for (unsigned int i = 0U; i < 64U; i++) {
+            uint32_t t1 = h + (rotr(e, 6U) ^ rotr(e, 11U) ^ rotr(e, 25U)) + ((e & f) ^ (~e & g)) + k[i] + w[i];
+            uint32_t t2 = (rotr(a, 2U) ^ rotr(a, 13U) ^ rotr(a, 22U)) + ((a & b) ^ (a & c) ^ (b & c));
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
+
+    inline void br_sha256_update(br_sha256_context *context, const void *data, size_t length) {
+        const uint8_t *bytes = (const uint8_t *) data;
+        for (size_t i = 0U; i < length; i++) {
+            context->block[context->count % BR_SHA256_BLOCK_SIZE] = bytes[i];
+            context->count++;
+            if (context->count % BR_SHA256_BLOCK_SIZE == 0U) {
+                br_sha256_round(context->state, context->block);
+            }
+        }
+    }
+
+    inline void br_sha256_out(const br_sha256_context *context, void *out) {
+        br_sha256_context last = *context;
+        uint64_t bits = context->count * 8U;
+        uint8_t pad = 0x80U;
+        br_sha256_update(&last, &pad, 1U);
+        pad = 0x00U;
+        while (last.count % BR_SHA256_BLOCK_SIZE != 56U) {
+            br_sha256_update(&last, &pad, 1U);
+        }
+        for (int shift = 56; shift >= 0; shift -= 8) {
+            pad = (uint8_t) (bits >> shift);
+            br_sha256_update(&last, &pad, 1U);
+        }
+
+        uint8_t *digest = (uint8_t *) out;
+        for (unsigned int i = 0U; i < 8U; i++) {
+            digest[i * 4U] = (uint8_t) (last.state[i] >> 24);
+            digest[i * 4U + 1U] = (uint8_t) (last.state[i] >> 16);
+            digest[i * 4U + 2U] = (uint8_t) (last.state[i] >> 8);
+            digest[i * 4U + 3U] = (uint8_t) last.state[i];
+        }
+    }
+
+    inline void br_hmac_key_init(br_hmac_key_context *keyContext, const br_hash_class *digest, const void *key, size_t keyLength) {
+        (void) digest;
+        memset(keyContext->key, 0, sizeof(keyContext->key));
+        if (keyLength > BR_SHA256_BLOCK_SIZE) { // Long keys are hashed first...
+            br_sha256_context context;
+            br_sha256_init(&context);
+            br_sha256_update(&context, key, keyLength);
+            br_sha256_out(&context, keyContext->key);
+        } else {
+            memcpy(keyContext->key, key, keyLength);
+        }
+    }
+
+    inline void br_hmac_init(br_hmac_context *context, const br_hmac_key_context *keyContext, size_t outLength) {
+        memcpy(context->key, keyContext->key, sizeof(context->key));
+        context->outLength = (outLength == 0U || outLength > BR_SHA256_SIZE ? BR_SHA256_SIZE : outLength);
+
+        uint8_t pad[BR_SHA256_BLOCK_SIZE];
+        for (unsigned int i = 0U; i < BR_SHA256_BLOCK_SIZE; i++) {
+            pad[i] = context->key[i] ^ 0x36U;
+        }
+        br_sha256_init(&context->inner);
+        br_sha256_update(&context->inner, pad, sizeof(pad));
+    }
+
+    inline void br_hmac_update(br_hmac_context *context, const void *data, size_t length) {
+        br_sha256_update(&context->inner, data, length);
+    }
+
+    inline size_t br_hmac_out(const br_hmac_context *context, void *out) {
+        uint8_t innerDigest[BR_SHA256_SIZE];
+        br_sha256_out(&context->inner, innerDigest);
+
+        uint8_t pad[BR_SHA256_BLOCK_SIZE];
+        for (unsigned int i = 0U; i < BR_SHA256_BLOCK_SIZE; i++) {
+            pad[i] = context->key[i] ^ 0x5cU;
+        }
+        br_sha256_context outer;
+        br_sha256_init(&outer);
+        br_sha256_update(&outer, pad, sizeof(pad));
+        br_sha256_update(&outer, innerDigest, sizeof(innerDigest));
+
+        uint8_t digest[BR_SHA256_SIZE];
+        br_sha256_out(&outer, digest);
+        memcpy(out, digest, context->outLength);
+
+        return context->outLength;
+    }
+
+#endif
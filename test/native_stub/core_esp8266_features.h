@@ -0,0 +1,15 @@
+/*
+  core_esp8266_features - A stand-in for the ESP8266 core header of the same
+  name, for the native test env only, giving what the libraries under test
+  take from it.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#ifndef CORE_ESP8266_FEATURES_H
+    #define CORE_ESP8266_FEATURES_H
+
+    inline void delay(unsigned long ms) { (void) ms; }
+
+#endif
@@ -0,0 +1,15 @@
+/*
+  pgmspace - A stand-in for the ESP8266 core header of the same name, for the
+  native test env only. The host has no separate program memory, so PROGMEM
+  data is ordinary const data.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#ifndef PGMSPACE_H
+    #define PGMSPACE_H
+
+    #define PROGMEM
+
+#endif
@@ -0,0 +1,161 @@
+/*
+  test_bench_centi_temp - Host benchmarks for the centi-degree control path
+  against the float one it replaced, run with
+  `pio test -e native -f test_bench_centi_temp -v` to see the timings. The
+  host has an FPU, so float arithmetic is as cheap as integer there and only
+  the formatting shows a gap; on the ESP8266 every float operation is a
+  soft-float call, so these are a floor on what the unit saves.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include <unity.h>
+#include <chrono>
+#include <stdio.h>
+#include <CentiTemp.h>
+
+#define BENCH_ROUNDS 200000U // Times each benchmark runs
+
+#define SENSOR_COUNT 3U
+
+static volatile long sink = 0L; // Keeps the work being timed from being optimized away
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+/**
+ * Reports how the float and centi-degree versions of something compare.
+ *
+ * @param what What was timed as char pointer.
+ * @param floatNanos The float version's time per round as double.
+ * @param centiNanos The centi-degree version's time per round as double.
+*/
+static void report(const char *what, double floatNanos, double centiNanos) {
+    char message[160];
+    snprintf(message, sizeof(message), "%s: float %.1f ns, centi %.1f ns, %.1fx", what, floatNanos, centiNanos, floatNanos / centiNanos);
+    TEST_MESSAGE(message);
+}
+
+/**
+ * Times the given work over BENCH_ROUNDS rounds, each given its round number.
+ *
+ * @param work The work to time as a callable.
+ *
+ * @return Returns the average time per round in nanoseconds as double.
+*/
+template <typename Work>
+static double nanosPerRound(Work work) {
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int round = 0U; round < BENCH_ROUNDS; round++) {
+        work(round);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    return (double) std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / (double) BENCH_ROUNDS;
+}
+
+/**
+ * The switching decision as it was made in floats before, returning 1 when
+ * too warm, -1 when too cool and 0 otherwise.
+ *
+ * @param temps The readings in degrees as float pointer.
+ * @param desired The desired temperature in degrees as float.
+ * @param padding The padding in degrees as float.
+ *
+ * @return Returns the decision as int.
+*/
+static int decideInFloats(const float *temps, float desired, float padding) {
+    float sum = 0.0f;
+    for (size_t i = 0U; i < SENSOR_COUNT; i++) {
+        sum += temps[i];
+    }
+    float temp = sum / SENSOR_COUNT;
+    if (temp < desired - padding) { // It's too cool...
+
+        return -1;
+    }
+    if (temp > desired + padding) { // It's too warm...
+
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * The same switching decision made the way it is now, in centi-degrees, with
+ * the mean rounded as TempAggregator rounds it.
+ *
+ * @param temps The readings in centi-degrees as int16_t pointer.
+ * @param desired The desired temperature in centi-degrees as int16_t.
+ * @param padding The padding in centi-degrees as int16_t.
+ *
+ * @return Returns the decision as int.
+*/
+static int decideInCenti(const int16_t *temps, int16_t desired, int16_t padding) {
+    int32_t sum = 0;
+    for (size_t i = 0U; i < SENSOR_COUNT; i++) {
+        sum += temps[i];
+    }
+    int32_t count = (int32_t) SENSOR_COUNT;
+    int16_t temp = (int16_t) ((sum >= 0 ? sum + count / 2 : sum - count / 2) / count);
+    if (temp < desired - padding) { // It's too cool...
+
+        return -1;
+    }
+    if (temp > desired + padding) { // It's too warm...
+
+        return 1;
+    }
+
+    return 0;
+}
+
+void test_bench_control_decision() {
+    float temps[SENSOR_COUNT] = { 70.25f, 71.5f, 72.0f };
+    int16_t centiTemps[SENSOR_COUNT];
+    for (size_t i = 0U; i < SENSOR_COUNT; i++) {
+        centiTemps[i] = CentiTemp::fromFloat(temps[i]);
+    }
+
+    // Both agree as the mean walks across the band...
+    for (int16_t step = -300; step <= 300; step += 25) {
+        float desired = 71.25f + step / 100.0f;
+        TEST_ASSERT_EQUAL(decideInFloats(temps, desired, 1.0f), decideInCenti(centiTemps, CentiTemp::fromFloat(desired), 100));
+    }
+
+    double floatNanos = nanosPerRound([&temps](unsigned int round) {
+        sink = sink + decideInFloats(temps, 69.0f + (round & 7U), 1.5f);
+    });
+    double centiNanos = nanosPerRound([&centiTemps](unsigned int round) {
+        sink = sink + decideInCenti(centiTemps, (int16_t) (6900 + 100 * (round & 7U)), 150);
+    });
+    report("mean of 3 and hysteresis", floatNanos, centiNanos);
+}
+
+void test_bench_format() {
+    char buffer[CENTI_TEMP_TEXT_SIZE + 8U];
+    snprintf(buffer, sizeof(buffer), "%.2f", 71.6f);
+    TEST_ASSERT_EQUAL_STRING("71.60", buffer);
+    CentiTemp::format(7160, buffer, sizeof(buffer));
+    TEST_ASSERT_EQUAL_STRING("71.6", buffer);
+
+    double floatNanos = nanosPerRound([&buffer](unsigned int round) {
+        sink = sink + snprintf(buffer, sizeof(buffer), "%.2f", 60.0f + (round & 1023U) / 100.0f);
+    });
+    double centiNanos = nanosPerRound([&buffer](unsigned int round) {
+        sink = sink + (long) CentiTemp::format((int16_t) (6000U + (round & 1023U)), buffer, sizeof(buffer));
+    });
+    report("write a temperature", floatNanos, centiNanos);
+}
+
+int main() {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_bench_control_decision);
+    RUN_TEST(test_bench_format);
+
+    return UNITY_END();
+}
@@ -0,0 +1,268 @@
+/*
+  test_bench_parse_utils - Host benchmarks for ParseUtils against the code it
+  replaced, run with `pio test -e native -f test_bench_parse_utils -v` to see
+  the timings. Each benchmark first checks both versions agree on its inputs,
+  the timings are only reported, as host timings don't make a pass or fail.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include <unity.h>
+#include <chrono>
+#include <stdio.h>
+#include <string>
+#include <ParseUtils.h>
+
+#define BENCH_ROUNDS 20000U // Times each benchmark runs through its inputs
+
+static volatile long sink = 0L; // Keeps the work being timed from being optimized away
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+/*
+=================================================================
+The code replaced, as it was, for comparison
+=================================================================
+*/
+
+static unsigned int oldOccurrences(std::string &str, char toCnt) {
+    unsigned int count = 0U;
+    for (unsigned int i = 0U; i < str.length(); i++) {
+        if (str.at(i) == toCnt) {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+static bool oldLooksNumeric(std::string &str) {
+    for (unsigned int i = 0; i < str.length(); i++) { // Verify that chars are valid for a number...
+        if (!((str.at(i) >= '0' && str.at(i) <= '9') || str.at(i) == '.' || str.at(i) == '-')) { // not even close to valid number...
+
+            return false;
+        }
+    }
+
+    int minus = oldOccurrences(str, '-');
+    if (minus > 1 || (minus == 1 && str.at(0) != '-')) { // too many minus signs or in wrong spot...
+
+        return false;
+    }
+
+    return (oldOccurrences(str, '.') <= 1U);
+}
+
+static float oldToFloat(std::string str) {
+    if (!str.empty()) { // Something to work on...
+        if (!oldLooksNumeric(str)) {
+
+            return 0;
+        }
+
+        return std::stof(str);
+    }
+
+    return 0;
+}
+
+static int oldToInt(std::string str) {
+    if (!str.empty()) { // Something to work on...
+        if (!oldLooksNumeric(str)) {
+
+            return 0;
+        }
+        if (oldOccurrences(str, '.') == 1U) { // Number is a float type...
+            // lose percision...
+            std::string temp = str.substr(0, str.find('.'));
+            if (temp.empty()) {
+
+                return 0;
+            }
+
+            return std::stoi(temp);
+        }
+    }
+
+    return std::stoi(str);
+}
+
+static String oldDecodeUrlString(String &str) {
+    str.replace("%20", " ");
+    str.replace("%21", "!");
+    str.replace("%23", "#");
+    str.replace("%24", "$");
+    str.replace("%26", "&");
+    str.replace("%27", "'");
+    str.replace("%28", "(");
+    str.replace("%29", ")");
+    str.replace("%2A", "*");
+    str.replace("+", " ");
+    str.replace("%2B", "+");
+    str.replace("%2C", ",");
+    str.replace("%2F", "/");
+    str.replace("%3A", ":");
+    str.replace("%3B", ";");
+    str.replace("%3D", "=");
+    str.replace("%3F", "?");
+    str.replace("%40", "@");
+    str.replace("%5B", "[");
+    str.replace("%2D", "]");
+    str.replace("%22", "\"");
+    str.replace("%25", "%");
+    str.replace("%2D", "-");
+    str.replace("%2E", ".");
+    str.replace("%3C", "<");
+    str.replace("%3E", ">");
+    str.replace("%5C", "\\");
+    str.replace("%5E", "^");
+    str.replace("%5F", "_");
+    str.replace("%60", "`");
+    str.replace("%7B", "{");
+    str.replace("%7C", "|");
+    str.replace("%7D", "}");
+    str.replace("%7E", "~");
+
+    return str;
+}
+
+/*
+=================================================================
+Benchmarks
+=================================================================
+*/
+
+// What gets typed into the admin page...
+static const char *const FORM_NUMBERS[] = { "71.6", "2", "-12.25", "1500", "0.45", "180", "71.655", "4000" };
+static const size_t FORM_NUMBER_COUNT = sizeof(FORM_NUMBERS) / sizeof(FORM_NUMBERS[0]);
+
+/**
+ * Times the given call over every one of the form numbers, BENCH_ROUNDS times.
+ *
+ * @param call The work to time, given each number, as a callable.
+ *
+ * @return Returns the average time per call in nanoseconds as double.
+*/
+template <typename Call>
+static double nanosPerCall(Call call) {
+    for (size_t i = 0U; i < FORM_NUMBER_COUNT; i++) { // Warm up...
+        call(FORM_NUMBERS[i]);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int round = 0U; round < BENCH_ROUNDS; round++) {
+        for (size_t i = 0U; i < FORM_NUMBER_COUNT; i++) {
+            call(FORM_NUMBERS[i]);
+        }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    return (double) std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / (double) (BENCH_ROUNDS * FORM_NUMBER_COUNT);
+}
+
+/**
+ * Reports how the old and new versions of something compare.
+ *
+ * @param what What was timed as char pointer.
+ * @param oldNanos The old version's time per call as double.
+ * @param newNanos The new version's time per call as double.
+*/
+static void report(const char *what, double oldNanos, double newNanos) {
+    char message[160];
+    snprintf(message, sizeof(message), "%s: old %.1f ns, new %.1f ns, %.1fx", what, oldNanos, newNanos, oldNanos / newNanos);
+    TEST_MESSAGE(message);
+}
+
+void test_bench_to_float() {
+    for (size_t i = 0U; i < FORM_NUMBER_COUNT; i++) {
+        float value = 0.0f;
+        TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseFloat(FORM_NUMBERS[i], value));
+        TEST_ASSERT_TRUE(value == oldToFloat(FORM_NUMBERS[i]));
+    }
+
+    double oldNanos = nanosPerCall([](const char *text) { sink = sink + (long) oldToFloat(text); });
+    double newNanos = nanosPerCall([](const char *text) {
+        float value = 0.0f;
+        ParseUtils::parseFloat(text, value);
+        sink = sink + (long) value;
+    });
+    report("std::stof toFloat vs parseFloat", oldNanos, newNanos);
+}
+
+void test_bench_to_int() {
+    for (size_t i = 0U; i < FORM_NUMBER_COUNT; i++) {
+        TEST_ASSERT_EQUAL(oldToInt(FORM_NUMBERS[i]), ParseUtils::toInt(FORM_NUMBERS[i]));
+    }
+
+    double oldNanos = nanosPerCall([](const char *text) { sink = sink + oldToInt(text); });
+    double newNanos = nanosPerCall([](const char *text) { sink = sink + ParseUtils::toInt(text); });
+    report("std::stoi toInt vs toInt", oldNanos, newNanos);
+}
+
+void test_bench_to_centi() {
+    for (size_t i = 0U; i < FORM_NUMBER_COUNT; i++) {
+        long centi = 0L;
+        TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseFixed(FORM_NUMBERS[i], 2U, centi));
+    }
+
+    // What a form temperature went through before, a float then scaled...
+    double oldNanos = nanosPerCall([](const char *text) {
+        float value = oldToFloat(text);
+        sink = sink + (long) (value * 100.0f + (value < 0.0f ? -0.5f : 0.5f));
+    });
+    double newNanos = nanosPerCall([](const char *text) {
+        long centi = 0L;
+        ParseUtils::parseFixed(text, 2U, centi);
+        sink = sink + centi;
+    });
+    report("std::stof to centi vs parseFixed", oldNanos, newNanos);
+}
+
+// Admin form fields as the browser sends them...
+static const char *const FORM_FIELDS[] = {
+    "My+Home%20Network", "P%40ssw0rd%21%23", "TempBuddy+Control", "Living+Room+%28East%29",
+    "sensor.local", "192.168.1.71", "a%2Bb%3Dc%3Bd", "%7E%2Fhome%3Fx%26y"
+};
+static const size_t FORM_FIELD_COUNT = sizeof(FORM_FIELDS) / sizeof(FORM_FIELDS[0]);
+
+void test_bench_decode_url() {
+    for (size_t i = 0U; i < FORM_FIELD_COUNT; i++) {
+        String expected = FORM_FIELDS[i];
+        String actual = FORM_FIELDS[i];
+        TEST_ASSERT_EQUAL_STRING(oldDecodeUrlString(expected).c_str(), ParseUtils::decodeUrlString(actual).c_str());
+    }
+
+    double nanos[2];
+    for (uint8_t version = 0U; version < 2U; version++) {
+        for (size_t i = 0U; i < FORM_FIELD_COUNT; i++) { // Warm up...
+            String field = FORM_FIELDS[i];
+            (version == 0U ? oldDecodeUrlString(field) : ParseUtils::decodeUrlString(field));
+        }
+
+        // The copy into a String is the same for both so it is timed too...
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned int round = 0U; round < BENCH_ROUNDS; round++) {
+            for (size_t i = 0U; i < FORM_FIELD_COUNT; i++) {
+                String field = FORM_FIELDS[i];
+                sink = sink + (long) (version == 0U ? oldDecodeUrlString(field) : ParseUtils::decodeUrlString(field)).length();
+            }
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        nanos[version] = (double) std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / (double) (BENCH_ROUNDS * FORM_FIELD_COUNT);
+    }
+    report("34 pass decodeUrlString vs decodeUrl", nanos[0], nanos[1]);
+}
+
+int main() {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_bench_to_float);
+    RUN_TEST(test_bench_to_int);
+    RUN_TEST(test_bench_to_centi);
+    RUN_TEST(test_bench_decode_url);
+
+    return UNITY_END();
+}
@@ -0,0 +1,156 @@
+/*
+  test_bench_settings_alloc - Counts the heap allocations one pass of the
+  sensor task and one pushed reading make through the Settings accessors, the
+  String getters they used before against the C string accessors and sensor
+  mask they use now, run with
+  `pio test -e native -f test_bench_settings_alloc -v` to see the counts.
+
+  Every settings value here is longer than a short string is kept inline, by
+  std::string on the host or by the core's String on the unit, so each String
+  made allocates as it would on the unit.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include <unity.h>
+#include <chrono>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <Settings.h>
+
+#define BENCH_ROUNDS 20000U // Times each benchmark runs
+
+static size_t allocations = 0U; // Counts every operator new in the program
+static volatile long sink = 0L; // Keeps the work being timed from being optimized away
+
+void* operator new(size_t size) {
+    allocations++;
+    void *block = malloc(size == 0U ? 1U : size);
+    if (block == NULL) {
+        throw std::bad_alloc();
+    }
+
+    return block;
+}
+
+void operator delete(void *block) noexcept {
+    free(block);
+}
+
+void operator delete(void *block, size_t size) noexcept {
+    (void) size;
+    free(block);
+}
+
+static Settings settings;
+
+void setUp(void) {
+    settings.setTempSensorHost(0U, "sensor-living-room.local");
+    settings.setTempSensorHost(1U, "");
+    settings.setTempSensorHost(2U, "sensor-bedroom-east.local");
+    settings.setPushKey("a-push-key-well-past-inline");
+}
+
+void tearDown(void) {}
+
+/**
+ * One pass of the sensor task and one pushed reading, as they read the
+ * settings before, through the String getters.
+*/
+static void passWithStrings() {
+    for (uint8_t i = 0U; i < TEMP_SENSOR_MAX_COUNT; i++) {
+        String host = settings.getTempSensorHost(i);
+        if (host.isEmpty() || host.equals("0.0.0.0")) { // Sensor not in use...
+
+            continue;
+        }
+        sink = sink + (long) host.length();
+    }
+
+    String pushKey = settings.getPushKey();
+    sink = sink + (long) pushKey.length() + (settings.getTempSensorHost(2U).isEmpty() ? 0L : 1L);
+}
+
+/**
+ * The same pass as it reads the settings now, through the C string accessors
+ * and the sensor mask.
+*/
+static void passWithCStrings() {
+    for (uint8_t i = 0U; i < TEMP_SENSOR_MAX_COUNT; i++) {
+        if (!settings.isTempSensorSet(i)) { // Sensor not in use...
+
+            continue;
+        }
+        sink = sink + (long) strlen(settings.getTempSensorHostCStr(i));
+    }
+
+    sink = sink + (long) strlen(settings.getPushKeyCStr()) + (settings.isTempSensorSet(2U) ? 1L : 0L);
+}
+
+/**
+ * Counts the allocations one run of the given pass makes.
+ *
+ * @param pass The pass to count as function pointer.
+ *
+ * @return Returns the number of allocations as size_t.
+*/
+static size_t allocationsPerPass(void (*pass)()) {
+    size_t before = allocations;
+    pass();
+
+    return allocations - before;
+}
+
+/**
+ * Times the given pass over BENCH_ROUNDS runs.
+ *
+ * @param pass The pass to time as function pointer.
+ *
+ * @return Returns the average time per pass in nanoseconds as double.
+*/
+static double nanosPerPass(void (*pass)()) {
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int round = 0U; round < BENCH_ROUNDS; round++) {
+        pass();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    return (double) std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / (double) BENCH_ROUNDS;
+}
+
+void test_pass_does_not_allocate() {
+    TEST_ASSERT_EQUAL(0U, allocationsPerPass(passWithCStrings));
+}
+
+void test_bench_allocations_per_pass() {
+    size_t withStrings = allocationsPerPass(passWithStrings);
+    size_t withCStrings = allocationsPerPass(passWithCStrings);
+    TEST_ASSERT_GREATER_THAN(withCStrings, withStrings);
+
+    double stringNanos = nanosPerPass(passWithStrings);
+    double cStringNanos = nanosPerPass(passWithCStrings);
+
+    char message[160];
+    snprintf(
+        message,
+        sizeof(message),
+        "allocations per pass: String getters %u, C strings %u; time per pass: %.1f ns vs %.1f ns",
+        (unsigned int) withStrings,
+        (unsigned int) withCStrings,
+        stringNanos,
+        cStringNanos
+    );
+    TEST_MESSAGE(message);
+}
+
+int main() {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_pass_does_not_allocate);
+    RUN_TEST(test_bench_allocations_per_pass);
+
+    return UNITY_END();
+}
@@ -0,0 +1,271 @@
+/*
+  test_bench_tls_handshake - Host benchmark of the CPU time a full TLS
+  handshake costs the server with the sample RSA 2048 cert and key against
+  the sample ECDSA P-256 ones in ExampleSecrets.h, run with
+  `pio test -e native -f test_bench_tls_handshake -v` to see the timings.
+
+  A BearSSL server and client run in memory, handing records straight to each
+  other, and the time each engine spends working on what it is handed is
+  added to its side. The client knows the server's key, as with setKnownKey()
+  on the unit, so no chain is checked. Sessions are never resumed, so every
+  handshake is a full one.
+
+  This needs BearSSL built for the host, which scripts/native_bearssl.py
+  finds; without it the benchmark is ignored. The unit's CPU is far slower
+  than the host's, so only the ratio between RSA and EC carries over.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include <unity.h>
+#include <ExampleSecrets.h>
+
+#ifdef NATIVE_HAS_BEARSSL
+
+#include <bearssl.h>
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#define BENCH_ROUNDS 50U // Handshakes timed for each key type
+
+/*
+  The time each side of the handshakes spent, in nanoseconds.
+*/
+struct SideTime {
+    double   serverNanos   ;
+    double   clientNanos   ;
+};
+
+static unsigned char serverBuffer[BR_SSL_BUFSIZE_BIDI];
+static unsigned char clientBuffer[BR_SSL_BUFSIZE_BIDI];
+static br_ssl_server_context server;
+static br_ssl_client_context client;
+static br_x509_minimal_context minimal;
+static br_x509_knownkey_context knownKey;
+static br_skey_decoder_context keyDecoder; // Holds the decoded private key
+static br_x509_decoder_context certDecoder; // Holds the decoded public key
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+/**
+ * Decodes the body of a PEM object, such as the sample cert or key, to DER.
+ *
+ * @param pem The PEM text as char pointer.
+ *
+ * @return Returns the DER bytes as unsigned char vector.
+*/
+static std::vector<unsigned char> pemToDer(const char *pem) {
+    static const char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::vector<unsigned char> der;
+    const char *at = strstr(pem, "-----BEGIN");
+    at = strchr(at, '\n');
+    const char *end = strstr(at, "-----END");
+    uint32_t bits = 0U;
+    int bitCount = 0;
+    for (; at < end; at++) {
+        const char *digit = strchr(ALPHABET, *at);
+        if (*at == '\0' || digit == NULL) { // Line break or padding...
+
+            continue;
+        }
+        bits = (bits << 6) | (uint32_t) (digit - ALPHABET);
+        bitCount += 6;
+        if (bitCount >= 8) {
+            bitCount -= 8;
+            der.push_back((unsigned char) (bits >> bitCount));
+        }
+    }
+
+    return der;
+}
+
+/**
+ * Does nothing with a distinguished name, which the benchmark has no use for.
+*/
+static void ignoreName(void *context, const void *data, size_t length) {
+    (void) context;
+    (void) data;
+    (void) length;
+}
+
+/**
+ * Hands whatever records one engine has to send to the other, timing the
+ * work each does with them.
+ *
+ * @param from The sending engine as br_ssl_engine_context pointer.
+ * @param to The receiving engine as br_ssl_engine_context pointer.
+ * @param fromNanos Receives the sender's time as double reference.
+ * @param toNanos Receives the receiver's time as double reference.
+ *
+ * @return Returns true if anything was handed over otherwise false as bool.
+*/
+static bool pump(br_ssl_engine_context *from, br_ssl_engine_context *to, double &fromNanos, double &toNanos) {
+    size_t length = 0U;
+    unsigned char *data = br_ssl_engine_sendrec_buf(from, &length);
+    size_t room = 0U;
+    unsigned char *target = (data == NULL ? NULL : br_ssl_engine_recvrec_buf(to, &room));
+    if (target == NULL) { // Nothing to hand over...
+
+        return false;
+    }
+    size_t count = (length < room ? length : room);
+    memcpy(target, data, count);
+
+    auto start = std::chrono::steady_clock::now();
+    br_ssl_engine_sendrec_ack(from, count);
+    auto sent = std::chrono::steady_clock::now();
+    br_ssl_engine_recvrec_ack(to, count);
+    auto received = std::chrono::steady_clock::now();
+    fromNanos += (double) std::chrono::duration_cast<std::chrono::nanoseconds>(sent - start).count();
+    toNanos += (double) std::chrono::duration_cast<std::chrono::nanoseconds>(received - sent).count();
+
+    return true;
+}
+
+/**
+ * Runs one full handshake between the server and client, which must have
+ * been set up for the key type being timed.
+ *
+ * @param time Has the time each side spent added to it as SideTime reference.
+ *
+ * @return Returns true if both sides finished the handshake otherwise false as bool.
+*/
+static bool handshake(SideTime &time) {
+    auto start = std::chrono::steady_clock::now();
+    br_ssl_server_reset(&server);
+    auto serverReset = std::chrono::steady_clock::now();
+    br_ssl_client_reset(&client, NULL, 0);
+    auto clientReset = std::chrono::steady_clock::now();
+    time.serverNanos += (double) std::chrono::duration_cast<std::chrono::nanoseconds>(serverReset - start).count();
+    time.clientNanos += (double) std::chrono::duration_cast<std::chrono::nanoseconds>(clientReset - serverReset).count();
+
+    while (true) {
+        unsigned int serverState = br_ssl_engine_current_state(&server.eng);
+        unsigned int clientState = br_ssl_engine_current_state(&client.eng);
+        if ((serverState & BR_SSL_CLOSED) != 0U || (clientState & BR_SSL_CLOSED) != 0U) { // Failed...
+
+            return false;
+        }
+        if ((serverState & BR_SSL_SENDAPP) != 0U && (clientState & BR_SSL_SENDAPP) != 0U) { // Both done...
+
+            return true;
+        }
+
+        bool moved = pump(&client.eng, &server.eng, time.clientNanos, time.serverNanos);
+        moved = pump(&server.eng, &client.eng, time.serverNanos, time.clientNanos) || moved;
+        if (!moved) { // Stuck...
+
+            return false;
+        }
+    }
+}
+
+/**
+ * Sets the client up to trust the server's cert by its key alone.
+ *
+ * @param certDer The server's cert as DER bytes as unsigned char vector.
+*/
+static void setUpClient(const std::vector<unsigned char> &certDer) {
+    br_x509_decoder_init(&certDecoder, ignoreName, NULL);
+    br_x509_decoder_push(&certDecoder, certDer.data(), certDer.size());
+    br_x509_pkey *publicKey = br_x509_decoder_get_pkey(&certDecoder);
+    TEST_ASSERT_NOT_NULL(publicKey);
+
+    br_ssl_client_init_full(&client, &minimal, NULL, 0U);
+    if (publicKey->key_type == BR_KEYTYPE_RSA) {
+        br_x509_knownkey_init_rsa(&knownKey, &publicKey->key.rsa, BR_KEYTYPE_KEYX | BR_KEYTYPE_SIGN);
+    } else {
+        br_x509_knownkey_init_ec(&knownKey, &publicKey->key.ec, BR_KEYTYPE_KEYX | BR_KEYTYPE_SIGN);
+    }
+    br_ssl_engine_set_x509(&client.eng, &knownKey.vtable);
+    br_ssl_engine_set_buffer(&client.eng, clientBuffer, sizeof(clientBuffer), 1);
+}
+
+/**
+ * Times BENCH_ROUNDS full handshakes with the given sample cert and key.
+ *
+ * @param certPem The server's cert as PEM as char pointer.
+ * @param keyPem The server's private key as PEM as char pointer.
+ * @param suite Receives the cipher suite that was agreed as uint16_t reference.
+ *
+ * @return Returns the average time per handshake for each side as SideTime.
+*/
+static SideTime timeHandshakes(const char *certPem, const char *keyPem, uint16_t &suite) {
+    std::vector<unsigned char> certDer = pemToDer(certPem);
+    std::vector<unsigned char> keyDer = pemToDer(keyPem);
+    br_x509_certificate chain = { certDer.data(), certDer.size() };
+
+    br_skey_decoder_init(&keyDecoder);
+    br_skey_decoder_push(&keyDecoder, keyDer.data(), keyDer.size());
+    TEST_ASSERT_EQUAL(0, br_skey_decoder_last_error(&keyDecoder));
+    if (br_skey_decoder_key_type(&keyDecoder) == BR_KEYTYPE_RSA) {
+        br_ssl_server_init_full_rsa(&server, &chain, 1U, br_skey_decoder_get_rsa(&keyDecoder));
+    } else { // Self signed, so the issuer's key is EC too...
+        br_ssl_server_init_full_ec(&server, &chain, 1U, BR_KEYTYPE_EC, br_skey_decoder_get_ec(&keyDecoder));
+    }
+    br_ssl_engine_set_buffer(&server.eng, serverBuffer, sizeof(serverBuffer), 1);
+    setUpClient(certDer);
+
+    // The first one warms up the RNG seeding and caches, so it isn't counted...
+    SideTime time = { 0.0, 0.0 };
+    TEST_ASSERT_TRUE(handshake(time));
+    time = { 0.0, 0.0 };
+    for (unsigned int round = 0U; round < BENCH_ROUNDS; round++) {
+        TEST_ASSERT_TRUE(handshake(time));
+    }
+
+    br_ssl_session_parameters parameters;
+    br_ssl_engine_get_session_parameters(&server.eng, &parameters);
+    suite = parameters.cipher_suite;
+    time.serverNanos /= (double) BENCH_ROUNDS;
+    time.clientNanos /= (double) BENCH_ROUNDS;
+
+    return time;
+}
+
+void test_bench_full_handshake() {
+    uint16_t rsaSuite = 0U;
+    uint16_t ecSuite = 0U;
+    SideTime rsa = timeHandshakes(SAMPLE_SERVER_CERT, SAMPLE_SERVER_KEY, rsaSuite);
+    SideTime ec = timeHandshakes(SAMPLE_SERVER_EC_CERT, SAMPLE_SERVER_EC_KEY, ecSuite);
+
+    char message[200];
+    snprintf(
+        message,
+        sizeof(message),
+        "server per handshake: RSA 2048 (suite 0x%04X) %.0f us, P-256 (suite 0x%04X) %.0f us, %.1fx; client: %.0f us vs %.0f us",
+        rsaSuite,
+        rsa.serverNanos / 1000.0,
+        ecSuite,
+        ec.serverNanos / 1000.0,
+        rsa.serverNanos / ec.serverNanos,
+        rsa.clientNanos / 1000.0,
+        ec.clientNanos / 1000.0
+    );
+    TEST_MESSAGE(message);
+}
+
+#else
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_bench_full_handshake() {
+    TEST_IGNORE_MESSAGE("BearSSL for the host wasn't found, see scripts/native_bearssl.py");
+}
+
+#endif
+
+int main() {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_bench_full_handshake);
+
+    return UNITY_END();
+}
@@ -0,0 +1,123 @@
+/*
+  test_centi_temp - Host tests for CentiTemp, run with
+  `pio test -e native -f test_centi_temp`.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include <unity.h>
+#include <CentiTemp.h>
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_clamp() {
+    TEST_ASSERT_EQUAL(7160, CentiTemp::clamp(7160));
+    TEST_ASSERT_EQUAL(INT16_MAX, CentiTemp::clamp(INT16_MAX));
+    TEST_ASSERT_EQUAL(INT16_MAX, CentiTemp::clamp((int32_t) INT16_MAX + 1));
+    TEST_ASSERT_EQUAL(INT16_MAX, CentiTemp::clamp(INT32_MAX));
+    TEST_ASSERT_EQUAL(INT16_MIN, CentiTemp::clamp(INT16_MIN));
+    TEST_ASSERT_EQUAL(INT16_MIN, CentiTemp::clamp((int32_t) INT16_MIN - 1));
+    TEST_ASSERT_EQUAL(INT16_MIN, CentiTemp::clamp(INT32_MIN));
+}
+
+void test_from_float_rounds_to_nearest() {
+    TEST_ASSERT_EQUAL(7160, CentiTemp::fromFloat(71.6f));
+    TEST_ASSERT_EQUAL(7166, CentiTemp::fromFloat(71.656f));
+    TEST_ASSERT_EQUAL(7165, CentiTemp::fromFloat(71.654f));
+    TEST_ASSERT_EQUAL(-7166, CentiTemp::fromFloat(-71.656f));
+    TEST_ASSERT_EQUAL(-7165, CentiTemp::fromFloat(-71.654f));
+    TEST_ASSERT_EQUAL(1, CentiTemp::fromFloat(0.005f));
+    TEST_ASSERT_EQUAL(-1, CentiTemp::fromFloat(-0.005f));
+    TEST_ASSERT_EQUAL(0, CentiTemp::fromFloat(0.0f));
+}
+
+void test_from_float_clamps() {
+    TEST_ASSERT_EQUAL(INT16_MAX, CentiTemp::fromFloat(327.67f));
+    TEST_ASSERT_EQUAL(INT16_MAX, CentiTemp::fromFloat(1000.0f));
+    TEST_ASSERT_EQUAL(INT16_MIN, CentiTemp::fromFloat(-1000.0f));
+}
+
+void test_to_float() {
+    TEST_ASSERT_TRUE(CentiTemp::toFloat(7160) == 71.6f);
+    TEST_ASSERT_TRUE(CentiTemp::toFloat(-5) == -0.05f);
+}
+
+void test_celsius_to_fahrenheit_rounds() {
+    TEST_ASSERT_EQUAL(3200, CentiTemp::celsiusToFahrenheit(0));
+    TEST_ASSERT_EQUAL(21200, CentiTemp::celsiusToFahrenheit(10000));
+    TEST_ASSERT_EQUAL(7070, CentiTemp::celsiusToFahrenheit(2150));
+    TEST_ASSERT_EQUAL(-4000, CentiTemp::celsiusToFahrenheit(-4000));
+
+    // 0.01 C is 0.018 F so rounds to 0.02 either side of 32...
+    TEST_ASSERT_EQUAL(3202, CentiTemp::celsiusToFahrenheit(1));
+    TEST_ASSERT_EQUAL(3198, CentiTemp::celsiusToFahrenheit(-1));
+    // 0.03 C is 0.054 F so rounds to 0.05...
+    TEST_ASSERT_EQUAL(3205, CentiTemp::celsiusToFahrenheit(3));
+    TEST_ASSERT_EQUAL(3195, CentiTemp::celsiusToFahrenheit(-3));
+}
+
+void test_celsius_to_fahrenheit_clamps() {
+    TEST_ASSERT_EQUAL(INT16_MAX, CentiTemp::celsiusToFahrenheit(20000));
+    TEST_ASSERT_EQUAL(INT16_MIN, CentiTemp::celsiusToFahrenheit(-20000));
+}
+
+void test_parse() {
+    int16_t centi = 0;
+    TEST_ASSERT_TRUE(CentiTemp::parse("71.6", centi));
+    TEST_ASSERT_EQUAL(7160, centi);
+    TEST_ASSERT_TRUE(CentiTemp::parse("71.655", centi));
+    TEST_ASSERT_EQUAL(7166, centi);
+    TEST_ASSERT_TRUE(CentiTemp::parse("-3", centi));
+    TEST_ASSERT_EQUAL(-300, centi);
+    TEST_ASSERT_TRUE(CentiTemp::parse(".25", centi));
+    TEST_ASSERT_EQUAL(25, centi);
+    TEST_ASSERT_TRUE(CentiTemp::parse("327.67", centi));
+    TEST_ASSERT_EQUAL(INT16_MAX, centi);
+    TEST_ASSERT_TRUE(CentiTemp::parse("-327.68", centi));
+    TEST_ASSERT_EQUAL(INT16_MIN, centi);
+}
+
+void test_parse_rejects_out_of_range() {
+    int16_t centi = 7;
+    TEST_ASSERT_FALSE(CentiTemp::parse("327.68", centi));
+    TEST_ASSERT_FALSE(CentiTemp::parse("327.675", centi));
+    TEST_ASSERT_FALSE(CentiTemp::parse("-327.69", centi));
+    TEST_ASSERT_FALSE(CentiTemp::parse("71.6F", centi));
+    TEST_ASSERT_FALSE(CentiTemp::parse("", centi));
+    TEST_ASSERT_EQUAL(7, centi);
+}
+
+void test_format() {
+    char buffer[CENTI_TEMP_TEXT_SIZE];
+    TEST_ASSERT_EQUAL(4U, CentiTemp::format(7160, buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL_STRING("71.6", buffer);
+    CentiTemp::format(7200, buffer, sizeof(buffer));
+    TEST_ASSERT_EQUAL_STRING("72", buffer);
+    CentiTemp::format(-5, buffer, sizeof(buffer));
+    TEST_ASSERT_EQUAL_STRING("-0.05", buffer);
+    TEST_ASSERT_EQUAL(7U, CentiTemp::format(INT16_MIN, buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL_STRING("-327.68", buffer);
+
+    char small[4];
+    TEST_ASSERT_EQUAL(0U, CentiTemp::format(7160, small, sizeof(small)));
+    TEST_ASSERT_EQUAL_STRING("", small);
+}
+
+int main() {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_clamp);
+    RUN_TEST(test_from_float_rounds_to_nearest);
+    RUN_TEST(test_from_float_clamps);
+    RUN_TEST(test_to_float);
+    RUN_TEST(test_celsius_to_fahrenheit_rounds);
+    RUN_TEST(test_celsius_to_fahrenheit_clamps);
+    RUN_TEST(test_parse);
+    RUN_TEST(test_parse_rejects_out_of_range);
+    RUN_TEST(test_format);
+
+    return UNITY_END();
+}
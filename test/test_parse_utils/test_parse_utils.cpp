@@ -0,0 +1,354 @@
+/*
+  test_parse_utils - Host tests for the ParseUtils number kernels and URL
+  decoding, run with `pio test -e native -f test_parse_utils`.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include <unity.h>
+#include <float.h>
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <ParseUtils.h>
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+/*
+=================================================================
+parseLong
+=================================================================
+*/
+
+void test_parse_long_sign() {
+    long value = 0L;
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseLong("42", value));
+    TEST_ASSERT_EQUAL(42L, value);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseLong("+42", value));
+    TEST_ASSERT_EQUAL(42L, value);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseLong("-42", value));
+    TEST_ASSERT_EQUAL(-42L, value);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseLong("-0", value));
+    TEST_ASSERT_EQUAL(0L, value);
+
+    value = 7L;
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_INVALID, ParseUtils::parseLong("-", value));
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_INVALID, ParseUtils::parseLong("+-1", value));
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_INVALID, ParseUtils::parseLong("--1", value));
+    TEST_ASSERT_EQUAL(7L, value);
+}
+
+void test_parse_long_overflow() {
+    char text[32];
+    long value = 0L;
+
+    snprintf(text, sizeof(text), "%ld", LONG_MAX);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseLong(text, value));
+    TEST_ASSERT_TRUE(value == LONG_MAX);
+    snprintf(text, sizeof(text), "%ld", LONG_MIN);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseLong(text, value));
+    TEST_ASSERT_TRUE(value == LONG_MIN);
+
+    value = 7L;
+    snprintf(text, sizeof(text), "%lu", (unsigned long) LONG_MAX + 1UL);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OUT_OF_RANGE, ParseUtils::parseLong(text, value));
+    snprintf(text, sizeof(text), "-%lu", (unsigned long) LONG_MAX + 2UL);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OUT_OF_RANGE, ParseUtils::parseLong(text, value));
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OUT_OF_RANGE, ParseUtils::parseLong("123456789012345678901234567890", value));
+    TEST_ASSERT_EQUAL(7L, value);
+
+    // Out of range only counts when the rest is still a number...
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_INVALID, ParseUtils::parseLong("123456789012345678901234567890x", value));
+}
+
+void test_parse_long_rejects_trailing_garbage() {
+    long value = 7L;
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_INVALID, ParseUtils::parseLong("12abc", value));
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_INVALID, ParseUtils::parseLong("12 ", value));
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_INVALID, ParseUtils::parseLong(" 12", value));
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_INVALID, ParseUtils::parseLong("12.0", value));
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_INVALID, ParseUtils::parseLong("0x12", value));
+    TEST_ASSERT_EQUAL(7L, value);
+
+    // Only the given length is looked at...
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseLong("12abc", 2U, value));
+    TEST_ASSERT_EQUAL(12L, value);
+}
+
+void test_parse_long_empty() {
+    long value = 7L;
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_EMPTY, ParseUtils::parseLong("", value));
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_EMPTY, ParseUtils::parseLong(NULL, value));
+    TEST_ASSERT_EQUAL(7L, value);
+}
+
+/*
+=================================================================
+parseFixed
+=================================================================
+*/
+
+void test_parse_fixed_rounding() {
+    long value = 0L;
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseFixed("71.655", 2U, value));
+    TEST_ASSERT_EQUAL(7166L, value);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseFixed("71.654", 2U, value));
+    TEST_ASSERT_EQUAL(7165L, value);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseFixed("71.6549", 2U, value));
+    TEST_ASSERT_EQUAL(7165L, value);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseFixed("-71.655", 2U, value));
+    TEST_ASSERT_EQUAL(-7166L, value);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseFixed("0.995", 2U, value));
+    TEST_ASSERT_EQUAL(100L, value);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseFixed("2.5", 0U, value));
+    TEST_ASSERT_EQUAL(3L, value);
+}
+
+void test_parse_fixed_fills_decimals() {
+    long value = 0L;
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseFixed("71.6", 2U, value));
+    TEST_ASSERT_EQUAL(7160L, value);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseFixed("71", 2U, value));
+    TEST_ASSERT_EQUAL(7100L, value);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseFixed(".5", 2U, value));
+    TEST_ASSERT_EQUAL(50L, value);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseFixed("5.", 2U, value));
+    TEST_ASSERT_EQUAL(500L, value);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseFixed("+0.05", 2U, value));
+    TEST_ASSERT_EQUAL(5L, value);
+}
+
+void test_parse_fixed_overflow() {
+    char text[40];
+    long value = 7L;
+
+    snprintf(text, sizeof(text), "%ld.00", LONG_MAX / 100L);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseFixed(text, 2U, value));
+    TEST_ASSERT_TRUE(value == (LONG_MAX / 100L) * 100L);
+
+    value = 7L;
+    snprintf(text, sizeof(text), "%ld", LONG_MAX / 100L + 1L);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OUT_OF_RANGE, ParseUtils::parseFixed(text, 2U, value));
+    snprintf(text, sizeof(text), "%ld.5", LONG_MAX);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OUT_OF_RANGE, ParseUtils::parseFixed(text, 0U, value));
+    TEST_ASSERT_EQUAL(7L, value);
+}
+
+void test_parse_fixed_rejects_trailing_garbage() {
+    long value = 7L;
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_INVALID, ParseUtils::parseFixed("71.6F", 2U, value));
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_INVALID, ParseUtils::parseFixed("71.6.1", 2U, value));
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_INVALID, ParseUtils::parseFixed("7e1", 2U, value));
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_INVALID, ParseUtils::parseFixed(".", 2U, value));
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_INVALID, ParseUtils::parseFixed("-", 2U, value));
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_EMPTY, ParseUtils::parseFixed("", 2U, value));
+    TEST_ASSERT_EQUAL(7L, value);
+}
+
+/*
+=================================================================
+parseFloat and parseDouble
+=================================================================
+*/
+
+void test_parse_float() {
+    float value = 0.0f;
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseFloat("71.6", value));
+    TEST_ASSERT_TRUE(value == 71.6f);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseFloat("-0.45", value));
+    TEST_ASSERT_TRUE(value == -0.45f);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseFloat("1.5e-2", value));
+    TEST_ASSERT_TRUE(value == 1.5e-2f);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseFloat("2E3", value));
+    TEST_ASSERT_TRUE(value == 2000.0f);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseFloat("3.4028235e38", value));
+    TEST_ASSERT_TRUE(value == FLT_MAX);
+
+    value = 7.0f;
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OUT_OF_RANGE, ParseUtils::parseFloat("3.5e38", value));
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OUT_OF_RANGE, ParseUtils::parseFloat("1e40", value));
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_INVALID, ParseUtils::parseFloat("1e", value));
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_INVALID, ParseUtils::parseFloat("1.0x", value));
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_INVALID, ParseUtils::parseFloat("nan", value));
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_EMPTY, ParseUtils::parseFloat("", value));
+    TEST_ASSERT_TRUE(value == 7.0f);
+}
+
+void test_parse_double() {
+    double value = 0.0;
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseDouble("0.123456789", value));
+    TEST_ASSERT_TRUE(value == 0.123456789);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseDouble("-1e300", value));
+    TEST_ASSERT_TRUE(fabs(value / -1e300 - 1.0) < 1e-12);
+
+    value = 7.0;
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OUT_OF_RANGE, ParseUtils::parseDouble("1e400", value));
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_INVALID, ParseUtils::parseDouble("1.5 ", value));
+    TEST_ASSERT_TRUE(value == 7.0);
+}
+
+void test_to_number_does_not_throw() {
+    TEST_ASSERT_EQUAL(0, ParseUtils::toInt(""));
+    TEST_ASSERT_EQUAL(0, ParseUtils::toInt("abc"));
+    TEST_ASSERT_EQUAL(0, ParseUtils::toInt("99999999999"));
+    TEST_ASSERT_EQUAL(12, ParseUtils::toInt("12.9"));
+    TEST_ASSERT_EQUAL(-12, ParseUtils::toInt("-12"));
+    TEST_ASSERT_TRUE(ParseUtils::toFloat("") == 0.0f);
+    TEST_ASSERT_TRUE(ParseUtils::toFloat("1..2") == 0.0f);
+    TEST_ASSERT_TRUE(ParseUtils::toDouble("-") == 0.0);
+}
+
+/*
+=================================================================
+formatLong, formatFixed and formatFloat
+=================================================================
+*/
+
+void test_format_fixed() {
+    char buffer[PARSE_UTILS_NUMBER_TEXT_SIZE];
+    TEST_ASSERT_EQUAL(5U, ParseUtils::formatFixed(7160L, 2U, false, buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL_STRING("71.60", buffer);
+    TEST_ASSERT_EQUAL(4U, ParseUtils::formatFixed(7160L, 2U, true, buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL_STRING("71.6", buffer);
+    TEST_ASSERT_EQUAL(2U, ParseUtils::formatFixed(7100L, 2U, true, buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL_STRING("71", buffer);
+    TEST_ASSERT_EQUAL(5U, ParseUtils::formatFixed(-5L, 2U, false, buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL_STRING("-0.05", buffer);
+    TEST_ASSERT_EQUAL(1U, ParseUtils::formatFixed(0L, 2U, true, buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL_STRING("0", buffer);
+}
+
+void test_format_does_not_overrun() {
+    char buffer[5];
+    TEST_ASSERT_EQUAL(4U, ParseUtils::formatFixed(1234L, 0U, false, buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL_STRING("1234", buffer);
+    TEST_ASSERT_EQUAL(0U, ParseUtils::formatFixed(12345L, 0U, false, buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL_STRING("", buffer);
+    TEST_ASSERT_EQUAL(0U, ParseUtils::formatFixed(1L, 0U, false, NULL, 0U));
+}
+
+void test_format_long_round_trips() {
+    char buffer[PARSE_UTILS_NUMBER_TEXT_SIZE];
+    char expected[PARSE_UTILS_NUMBER_TEXT_SIZE];
+    long value = 0L;
+
+    ParseUtils::formatLong(LONG_MIN, buffer, sizeof(buffer));
+    snprintf(expected, sizeof(expected), "%ld", LONG_MIN);
+    TEST_ASSERT_EQUAL_STRING(expected, buffer);
+    TEST_ASSERT_EQUAL(ParseUtils::NUMBER_OK, ParseUtils::parseLong(buffer, value));
+    TEST_ASSERT_TRUE(value == LONG_MIN);
+
+    ParseUtils::formatLong(LONG_MAX, buffer, sizeof(buffer));
+    snprintf(expected, sizeof(expected), "%ld", LONG_MAX);
+    TEST_ASSERT_EQUAL_STRING(expected, buffer);
+}
+
+void test_format_float() {
+    char buffer[PARSE_UTILS_NUMBER_TEXT_SIZE];
+    ParseUtils::formatFloat(2.5f, 0U, false, buffer, sizeof(buffer));
+    TEST_ASSERT_EQUAL_STRING("3", buffer);
+    ParseUtils::formatFloat(-2.5f, 0U, false, buffer, sizeof(buffer));
+    TEST_ASSERT_EQUAL_STRING("-3", buffer);
+    ParseUtils::formatFloat(0.45f, 6U, true, buffer, sizeof(buffer));
+    TEST_ASSERT_EQUAL_STRING("0.45", buffer);
+    TEST_ASSERT_EQUAL(0U, ParseUtils::formatFloat(NAN, 2U, false, buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL(0U, ParseUtils::formatFloat(1e30f, 2U, false, buffer, sizeof(buffer)));
+}
+
+/*
+=================================================================
+decodeUrl
+=================================================================
+*/
+
+/**
+ * Decodes the given text with decodeUrl() into a buffer of its own.
+ *
+ * @param text The text to decode as char pointer.
+ * @param plusIsSpace True to take a plus as a space otherwise false as bool.
+ *
+ * @return Returns the decoded text as std::string.
+*/
+static std::string decode(const char *text, bool plusIsSpace = true) {
+    char buffer[64];
+    size_t length = ParseUtils::decodeUrl(text, strlen(text), buffer, sizeof(buffer), plusIsSpace);
+
+    return std::string(buffer, length);
+}
+
+void test_decode_url_escapes() {
+    TEST_ASSERT_EQUAL_STRING("-", decode("%2D").c_str());
+    TEST_ASSERT_EQUAL_STRING("-", decode("%2d").c_str());
+    TEST_ASSERT_EQUAL_STRING("a-b", decode("a%2Db").c_str());
+    TEST_ASSERT_EQUAL_STRING("P@ssw0rd!", decode("P%40ssw0rd%21").c_str());
+    TEST_ASSERT_EQUAL_STRING("\xC3\xA9", decode("%C3%A9").c_str());
+
+    // A decoded % isn't decoded again...
+    TEST_ASSERT_EQUAL_STRING("%41", decode("%2541").c_str());
+}
+
+void test_decode_url_plus() {
+    TEST_ASSERT_EQUAL_STRING("a b", decode("a+b").c_str());
+    TEST_ASSERT_EQUAL_STRING("a+b", decode("a%2Bb").c_str());
+    TEST_ASSERT_EQUAL_STRING("a+b", decode("a+b", false).c_str());
+    TEST_ASSERT_EQUAL_STRING("a+b c", decode("a+b%20c", false).c_str());
+}
+
+void test_decode_url_keeps_broken_escapes() {
+    TEST_ASSERT_EQUAL_STRING("%4", decode("%4").c_str());
+    TEST_ASSERT_EQUAL_STRING("ab%", decode("ab%").c_str());
+    TEST_ASSERT_EQUAL_STRING("%G1", decode("%G1").c_str());
+    TEST_ASSERT_EQUAL_STRING("%1G", decode("%1G").c_str());
+    TEST_ASSERT_EQUAL_STRING("%zz-", decode("%zz%2d").c_str());
+}
+
+void test_decode_url_in_place() {
+    std::string text = "My+Home%20Net%2d2";
+    TEST_ASSERT_EQUAL_STRING("My Home Net-2", ParseUtils::decodeUrlString(text).c_str());
+    TEST_ASSERT_EQUAL(13U, text.length());
+
+    String str = "Living+Room%21";
+    TEST_ASSERT_EQUAL_STRING("Living Room!", ParseUtils::decodeUrlString(str).c_str());
+    TEST_ASSERT_EQUAL(12U, str.length());
+}
+
+void test_decode_url_does_not_overrun() {
+    char buffer[4];
+    TEST_ASSERT_EQUAL(3U, ParseUtils::decodeUrl("a%20b", 5U, buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL_STRING("a b", buffer);
+    TEST_ASSERT_EQUAL(0U, ParseUtils::decodeUrl("abcd", 4U, buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL_STRING("", buffer);
+    TEST_ASSERT_EQUAL(0U, ParseUtils::decodeUrl("a", 1U, NULL, 0U));
+}
+
+int main() {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_parse_long_sign);
+    RUN_TEST(test_parse_long_overflow);
+    RUN_TEST(test_parse_long_rejects_trailing_garbage);
+    RUN_TEST(test_parse_long_empty);
+    RUN_TEST(test_parse_fixed_rounding);
+    RUN_TEST(test_parse_fixed_fills_decimals);
+    RUN_TEST(test_parse_fixed_overflow);
+    RUN_TEST(test_parse_fixed_rejects_trailing_garbage);
+    RUN_TEST(test_parse_float);
+    RUN_TEST(test_parse_double);
+    RUN_TEST(test_to_number_does_not_throw);
+    RUN_TEST(test_format_fixed);
+    RUN_TEST(test_format_does_not_overrun);
+    RUN_TEST(test_format_long_round_trips);
+    RUN_TEST(test_format_float);
+    RUN_TEST(test_decode_url_escapes);
+    RUN_TEST(test_decode_url_plus);
+    RUN_TEST(test_decode_url_keeps_broken_escapes);
+    RUN_TEST(test_decode_url_in_place);
+    RUN_TEST(test_decode_url_does_not_overrun);
+
+    return UNITY_END();
+}
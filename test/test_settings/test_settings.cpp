@@ -0,0 +1,208 @@
+/*
+  test_settings - Host tests for storing and loading Settings, run with
+  `pio test -e native -f test_settings`.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include <unity.h>
+#include <string.h>
+#include <Settings.h>
+
+/*
+  The settings layout as the first release stored it, before layoutVersion,
+  along with the sentinel it was stored with.
+*/
+struct ReleasedSettings {
+    char           ssid             [33]  ;
+    char           pwd              [64]  ;
+    char           adminUser        [13]  ;
+    char           adminPwd         [13]  ;
+    char           title            [51]  ;
+    char           heading          [51]  ;
+    char           tempSensorIp     [16]  ;
+    float          desiredTemp            ;
+    float          tempPadding            ;
+    bool           isHeat                 ;
+    bool           isAutoControl          ;
+    char           sentinel         [33]  ;
+};
+
+/**
+ * Stores the given settings in the released layout, working out the sentinel
+ * the way the released firmware did.
+ *
+ * @param released The settings to store as ReleasedSettings reference.
+*/
+static void storeReleased(ReleasedSettings &released) {
+    String content = "";
+    content = content + String(released.ssid);
+    content = content + String(released.pwd);
+    content = content + String(released.adminUser);
+    content = content + String(released.adminPwd);
+    content = content + String(released.title);
+    content = content + String(released.heading);
+    content = content + String(released.tempSensorIp);
+    content = content + String(released.desiredTemp);
+    content = content + String(released.tempPadding);
+    content = content + String(released.isHeat);
+    content = content + String(released.isAutoControl);
+
+    MD5Builder builder = MD5Builder();
+    builder.begin();
+    builder.add(content);
+    builder.calculate();
+    strcpy(released.sentinel, builder.toString().c_str());
+
+    EEPROM.begin(sizeof(ReleasedSettings));
+    EEPROM.put(0, released);
+    EEPROM.commit();
+    EEPROM.end();
+}
+
+/**
+ * Makes settings as a unit on the released firmware would have stored them.
+ *
+ * @return Returns the settings as ReleasedSettings.
+*/
+static ReleasedSettings makeReleased() {
+    ReleasedSettings released;
+    memset(&released, 0, sizeof(released));
+    strcpy(released.ssid, "HomeNetwork");
+    strcpy(released.pwd, "network-password");
+    strcpy(released.adminUser, "owner");
+    strcpy(released.adminPwd, "admin-pass");
+    strcpy(released.title, "Garage Heater");
+    strcpy(released.heading, "Garage");
+    strcpy(released.tempSensorIp, "192.168.1.71");
+    released.desiredTemp = 55.5f;
+    released.tempPadding = 1.25f;
+    released.isHeat = true;
+    released.isAutoControl = true;
+
+    return released;
+}
+
+void setUp(void) {
+    EEPROM.wipe();
+}
+
+void tearDown(void) {}
+
+void test_nothing_stored() {
+    Settings settings;
+    TEST_ASSERT_FALSE(settings.loadSettings());
+    TEST_ASSERT_TRUE(settings.isFactoryDefault());
+}
+
+void test_saved_settings_load() {
+    Settings saved;
+    saved.setTitle("Shop");
+    saved.setTempSensorHost(1U, "sensor.local");
+    saved.setDesiredTempCenti(6850);
+    TEST_ASSERT_TRUE(saved.saveSettings());
+
+    Settings loaded;
+    TEST_ASSERT_TRUE(loaded.loadSettings());
+    TEST_ASSERT_EQUAL_STRING("Shop", loaded.getTitleCStr());
+    TEST_ASSERT_EQUAL_STRING("sensor.local", loaded.getTempSensorHostCStr(1U));
+    TEST_ASSERT_EQUAL(6850, loaded.getDesiredTempCenti());
+    TEST_ASSERT_TRUE(loaded.isTempSensorSet(1U));
+}
+
+void test_released_settings_carry_forward() {
+    ReleasedSettings released = makeReleased();
+    storeReleased(released);
+
+    Settings settings;
+    TEST_ASSERT_TRUE(settings.loadSettings());
+    TEST_ASSERT_EQUAL_STRING("HomeNetwork", settings.getSsidCStr());
+    TEST_ASSERT_EQUAL_STRING("network-password", settings.getPwdCStr());
+    TEST_ASSERT_EQUAL_STRING("owner", settings.getAdminUserCStr());
+    TEST_ASSERT_EQUAL_STRING("admin-pass", settings.getAdminPwdCStr());
+    TEST_ASSERT_EQUAL_STRING("Garage Heater", settings.getTitleCStr());
+    TEST_ASSERT_EQUAL_STRING("Garage", settings.getHeadingCStr());
+    TEST_ASSERT_EQUAL_STRING("192.168.1.71", settings.getTempSensorHostCStr(0U));
+    TEST_ASSERT_TRUE(settings.isTempSensorSet(0U));
+    TEST_ASSERT_FALSE(settings.isTempSensorSet(1U));
+    TEST_ASSERT_EQUAL(5550, settings.getDesiredTempCenti());
+    TEST_ASSERT_EQUAL(125, settings.getTempPaddingCenti());
+    TEST_ASSERT_TRUE(settings.getIsHeat());
+    TEST_ASSERT_TRUE(settings.getIsAutoControl());
+    TEST_ASSERT_TRUE(settings.isNetworkSet());
+
+    // Settings added since then are at their defaults...
+    Settings defaults;
+    TEST_ASSERT_EQUAL(defaults.getUdpPort(), settings.getUdpPort());
+    TEST_ASSERT_EQUAL_STRING(defaults.getPushKeyCStr(), settings.getPushKeyCStr());
+    TEST_ASSERT_EQUAL(defaults.getPollFloorSec(), settings.getPollFloorSec());
+}
+
+void test_released_image_loads_at_the_current_size() {
+    ReleasedSettings released = makeReleased();
+    storeReleased(released);
+
+    // Like the library, the stand-in finds nothing stored at another size...
+    EEPROM.begin(sizeof(ReleasedSettings) + 64U);
+    TEST_ASSERT_EQUAL(-1, EEPROM.percentUsed());
+    EEPROM.end();
+
+    Settings settings;
+    TEST_ASSERT_TRUE(settings.loadSettings());
+    TEST_ASSERT_EQUAL_STRING("HomeNetwork", settings.getSsidCStr());
+    TEST_ASSERT_FALSE(settings.isFactoryDefault());
+}
+
+void test_carried_forward_settings_are_saved_in_the_current_layout() {
+    ReleasedSettings released = makeReleased();
+    storeReleased(released);
+    Settings migrated;
+    TEST_ASSERT_TRUE(migrated.loadSettings());
+
+    Settings loaded;
+    TEST_ASSERT_TRUE(loaded.loadSettings());
+    TEST_ASSERT_EQUAL_STRING("HomeNetwork", loaded.getSsidCStr());
+    TEST_ASSERT_EQUAL(5550, loaded.getDesiredTempCenti());
+}
+
+void test_released_strings_are_kept_in_bounds() {
+    ReleasedSettings released = makeReleased();
+    memset(released.heading, 'h', sizeof(released.heading) - 1U);
+    storeReleased(released);
+
+    Settings settings;
+    TEST_ASSERT_TRUE(settings.loadSettings());
+    TEST_ASSERT_EQUAL(sizeof(released.heading) - 1U, strlen(settings.getHeadingCStr()));
+}
+
+void test_corrupt_settings_are_defaulted() {
+    ReleasedSettings released = makeReleased();
+    storeReleased(released);
+
+    // A bit flipped after the sentinel was worked out...
+    released.isHeat = false;
+    EEPROM.begin(sizeof(ReleasedSettings));
+    EEPROM.put(0, released);
+    EEPROM.commit();
+    EEPROM.end();
+
+    Settings settings;
+    TEST_ASSERT_FALSE(settings.loadSettings());
+    TEST_ASSERT_TRUE(settings.isFactoryDefault());
+    TEST_ASSERT_FALSE(settings.isNetworkSet());
+}
+
+int main() {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_nothing_stored);
+    RUN_TEST(test_saved_settings_load);
+    RUN_TEST(test_released_settings_carry_forward);
+    RUN_TEST(test_released_image_loads_at_the_current_size);
+    RUN_TEST(test_carried_forward_settings_are_saved_in_the_current_layout);
+    RUN_TEST(test_released_strings_are_kept_in_bounds);
+    RUN_TEST(test_corrupt_settings_are_defaulted);
+
+    return UNITY_END();
+}
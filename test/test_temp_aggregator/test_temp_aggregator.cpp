@@ -0,0 +1,116 @@
+/*
+  test_temp_aggregator - Host tests for TempAggregator, run with
+  `pio test -e native -f test_temp_aggregator`.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include <unity.h>
+#include <TempAggregator.h>
+
+#define MAX_AGE 1000UL
+
+static TempAggregator::Reading readings[4];
+
+void setUp(void) {
+    for (size_t i = 0U; i < 4U; i++) {
+        readings[i].centiF = 0;
+        readings[i].readAt = 0UL;
+        readings[i].hasReading = false;
+        readings[i].used = false;
+    }
+}
+
+void tearDown(void) {}
+
+/**
+ * Gives the reading at the given index the given temperature, read now.
+ *
+ * @param index The index of the reading as size_t.
+ * @param centiF The temperature in hundredths of a degree F as int16_t.
+*/
+static void setReading(size_t index, int16_t centiF) {
+    readings[index].centiF = centiF;
+    readings[index].readAt = 0UL;
+    readings[index].hasReading = true;
+}
+
+void test_mean_rounds_half_away_from_zero() {
+    int16_t result = 0;
+    setReading(0U, 7001);
+    setReading(1U, 7002);
+    TEST_ASSERT_TRUE(TempAggregator::aggregate(readings, 2U, TempAggregator::MEAN, 0UL, MAX_AGE, result));
+    TEST_ASSERT_EQUAL(7002, result);
+
+    setReading(0U, -7001);
+    setReading(1U, -7002);
+    TEST_ASSERT_TRUE(TempAggregator::aggregate(readings, 2U, TempAggregator::MEAN, 0UL, MAX_AGE, result));
+    TEST_ASSERT_EQUAL(-7002, result);
+}
+
+void test_median() {
+    int16_t result = 0;
+    setReading(0U, 7200);
+    setReading(1U, 7000);
+    setReading(2U, 7100);
+    TEST_ASSERT_TRUE(TempAggregator::aggregate(readings, 3U, TempAggregator::MEDIAN, 0UL, MAX_AGE, result));
+    TEST_ASSERT_EQUAL(7100, result);
+
+    // An even count takes the mean of the middle two...
+    setReading(3U, 7125);
+    TEST_ASSERT_TRUE(TempAggregator::aggregate(readings, 4U, TempAggregator::MEDIAN, 0UL, MAX_AGE, result));
+    TEST_ASSERT_EQUAL(7113, result);
+}
+
+void test_outlier_is_left_out() {
+    int16_t result = 0;
+    setReading(0U, 7000);
+    setReading(1U, 7100);
+    setReading(2U, 7100 + TEMP_AGGREGATOR_OUTLIER_CENTI + 1);
+    TEST_ASSERT_TRUE(TempAggregator::aggregate(readings, 3U, TempAggregator::MAX, 0UL, MAX_AGE, result));
+    TEST_ASSERT_EQUAL(7100, result);
+    TEST_ASSERT_FALSE(readings[2].used);
+
+    // With only two there's no telling which is off...
+    TEST_ASSERT_TRUE(TempAggregator::aggregate(readings + 1U, 2U, TempAggregator::MAX, 0UL, MAX_AGE, result));
+    TEST_ASSERT_EQUAL(7100 + TEMP_AGGREGATOR_OUTLIER_CENTI + 1, result);
+}
+
+void test_stale_readings_are_left_out() {
+    int16_t result = 0;
+    setReading(0U, 7000);
+    setReading(1U, 8000);
+    readings[1].readAt = 5000UL;
+    TEST_ASSERT_TRUE(TempAggregator::aggregate(readings, 2U, TempAggregator::MIN, 5000UL, MAX_AGE, result));
+    TEST_ASSERT_EQUAL(8000, result);
+    TEST_ASSERT_FALSE(readings[0].used);
+}
+
+void test_no_readings() {
+    int16_t result = 7;
+    TEST_ASSERT_FALSE(TempAggregator::aggregate(readings, 3U, TempAggregator::MEDIAN, 0UL, MAX_AGE, result));
+    TEST_ASSERT_EQUAL(7, result);
+}
+
+void test_primary_failover() {
+    int16_t result = 0;
+    setReading(1U, 7100);
+    setReading(2U, 7200);
+    TEST_ASSERT_TRUE(TempAggregator::aggregate(readings, 3U, TempAggregator::PRIMARY_FAILOVER, 0UL, MAX_AGE, result));
+    TEST_ASSERT_EQUAL(7100, result);
+    TEST_ASSERT_FALSE(readings[2].used);
+}
+
+int main() {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_mean_rounds_half_away_from_zero);
+    RUN_TEST(test_median);
+    RUN_TEST(test_outlier_is_left_out);
+    RUN_TEST(test_stale_readings_are_left_out);
+    RUN_TEST(test_no_readings);
+    RUN_TEST(test_primary_failover);
+
+    return UNITY_END();
+}
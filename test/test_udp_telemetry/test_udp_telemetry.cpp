@@ -0,0 +1,361 @@
+/*
+  test_udp_telemetry - Host tests for UdpTelemetry, run with
+  `pio test -e native -f test_udp_telemetry`. A Sensor here does what a real
+  sensor does: it hears the unit's beacons and sends signed readings back, so
+  the datagrams going each way are checked byte for byte through the stand-in
+  WiFiUDP.
+
+  Written by: Scott Griffis
+  Date: 10-16-2026
+*/
+
+#include <unity.h>
+#include <string.h>
+#include <vector>
+#include <UdpTelemetry.h>
+
+#define PORT 4210U
+#define KEY "a-shared-push-key"
+#define BOOT_ID 0x1A2B3C4DUL
+
+/*
+  A sensor as the README has it behave: after booting it sends nothing until
+  it hears a beacon, it copies the boot id and sequence number of the latest
+  beacon it has heard into each reading, and its own sequence number counts up
+  from one each time it boots.
+*/
+struct Sensor {
+    uint8_t    index            ;
+    bool       hasBeacon        ;
+    uint32_t   unitBootId       ;
+    uint32_t   beaconSequence   ;
+    uint32_t   sequence         ;
+};
+
+static UdpTelemetry *telemetry = NULL;
+static std::vector<int16_t> handled; // What the handler was called with
+static std::vector<uint8_t> handledSensors;
+
+/**
+ * Works out the truncated HMAC of the given data the way a sensor would.
+ *
+ * @param data The data to sign as uint8_t pointer.
+ * @param length The length of the data as size_t.
+ * @param key The key to sign with as char pointer.
+ * @param mac Receives UDP_TELEMETRY_MAC_SIZE bytes as uint8_t pointer.
+*/
+static void sign(const uint8_t *data, size_t length, const char *key, uint8_t *mac) {
+    br_hmac_key_context keyContext;
+    br_hmac_context context;
+    br_hmac_key_init(&keyContext, &br_sha256_vtable, key, strlen(key));
+    br_hmac_init(&context, &keyContext, UDP_TELEMETRY_MAC_SIZE);
+    br_hmac_update(&context, data, length);
+    br_hmac_out(&context, mac);
+}
+
+/**
+ * Reads four little-endian bytes as a value.
+*/
+static uint32_t get32(const uint8_t *at) {
+
+    return (uint32_t) at[0] | ((uint32_t) at[1] << 8) | ((uint32_t) at[2] << 16) | ((uint32_t) at[3] << 24);
+}
+
+/**
+ * Writes the given value as four little-endian bytes.
+*/
+static void put32(uint8_t *at, uint32_t value) {
+    at[0] = (uint8_t) value;
+    at[1] = (uint8_t) (value >> 8);
+    at[2] = (uint8_t) (value >> 16);
+    at[3] = (uint8_t) (value >> 24);
+}
+
+/**
+ * Makes a sensor as it is right after booting.
+ *
+ * @param index The sensor's index as uint8_t.
+ *
+ * @return Returns the sensor as Sensor.
+*/
+static Sensor bootSensor(uint8_t index) {
+    Sensor sensor;
+    sensor.index = index;
+    sensor.hasBeacon = false;
+    sensor.unitBootId = 0U;
+    sensor.beaconSequence = 0U;
+    sensor.sequence = 0U;
+
+    return sensor;
+}
+
+/**
+ * Has the unit send a beacon and the sensor hear it, as a sensor would: the
+ * beacon must verify and be newer than the last one heard from that boot.
+ *
+ * @param sensor The sensor hearing it as Sensor reference.
+ *
+ * @return Returns the beacon as it went out as uint8_t vector.
+*/
+static std::vector<uint8_t> beacon(Sensor &sensor) {
+    telemetry->sendBeacon(true, true, false, 7160, 7000, 150, 3UL);
+    std::vector<uint8_t> packet = WiFiUDP::sent.back().data;
+    TEST_ASSERT_EQUAL(UDP_TELEMETRY_BEACON_SIZE, packet.size());
+
+    uint8_t mac[UDP_TELEMETRY_MAC_SIZE];
+    sign(packet.data(), UDP_TELEMETRY_BEACON_SIZE - UDP_TELEMETRY_MAC_SIZE, KEY, mac);
+    TEST_ASSERT_EQUAL_MEMORY(mac, packet.data() + UDP_TELEMETRY_BEACON_SIZE - UDP_TELEMETRY_MAC_SIZE, UDP_TELEMETRY_MAC_SIZE);
+
+    uint32_t unitBootId = get32(packet.data() + 8);
+    uint32_t beaconSequence = get32(packet.data() + 12);
+    if (!sensor.hasBeacon || unitBootId != sensor.unitBootId || beaconSequence > sensor.beaconSequence) { // Newer...
+        sensor.hasBeacon = true;
+        sensor.unitBootId = unitBootId;
+        sensor.beaconSequence = beaconSequence;
+    }
+
+    return packet;
+}
+
+/**
+ * Makes the sensor's next signed reading.
+ *
+ * @param sensor The sensor sending it as Sensor reference.
+ * @param unit The unit, F or C, as char.
+ * @param centiTemp The temperature in hundredths of a degree as int16_t.
+ *
+ * @return Returns the reading as uint8_t vector.
+*/
+static std::vector<uint8_t> reading(Sensor &sensor, char unit, int16_t centiTemp) {
+    TEST_ASSERT_TRUE_MESSAGE(sensor.hasBeacon, "A sensor sends nothing before it hears a beacon");
+    sensor.sequence++;
+
+    std::vector<uint8_t> packet(UDP_TELEMETRY_READING_SIZE, 0U);
+    packet[0] = UDP_TELEMETRY_MAGIC_0;
+    packet[1] = UDP_TELEMETRY_MAGIC_1;
+    packet[2] = UDP_TELEMETRY_VERSION;
+    packet[3] = UDP_TELEMETRY_TYPE_READING;
+    packet[4] = sensor.index;
+    packet[5] = (uint8_t) unit;
+    put32(packet.data() + 8, sensor.unitBootId);
+    put32(packet.data() + 12, sensor.beaconSequence);
+    put32(packet.data() + 16, sensor.sequence);
+    packet[20] = (uint8_t) centiTemp;
+    packet[21] = (uint8_t) ((uint16_t) centiTemp >> 8);
+    packet[22] = (uint8_t) UDP_TELEMETRY_NO_VALUE;
+    packet[23] = (uint8_t) (UDP_TELEMETRY_NO_VALUE >> 8);
+    sign(packet.data(), UDP_TELEMETRY_READING_SIZE - UDP_TELEMETRY_MAC_SIZE, KEY, packet.data() + UDP_TELEMETRY_READING_SIZE - UDP_TELEMETRY_MAC_SIZE);
+
+    return packet;
+}
+
+/**
+ * Sends the given datagram to the unit and has it handled.
+ *
+ * @param packet The datagram as uint8_t vector.
+*/
+static void send(const std::vector<uint8_t> &packet) {
+    WiFiUDP::inbound.push_back(packet);
+    telemetry->handle([](uint8_t sensor, int16_t centiF) {
+        handledSensors.push_back(sensor);
+        handled.push_back(centiF);
+    });
+}
+
+/**
+ * Reboots the unit under test, which starts it with a new boot id.
+ *
+ * @param bootId The new boot id as uint32_t.
+*/
+static void rebootUnit(uint32_t bootId) {
+    delete telemetry;
+    telemetry = new UdpTelemetry();
+    TEST_ASSERT_TRUE(telemetry->begin(PORT, KEY, bootId));
+}
+
+void setUp(void) {
+    WiFiUDP::inbound.clear();
+    WiFiUDP::sent.clear();
+    handled.clear();
+    handledSensors.clear();
+    nativeMillis = 0UL;
+    rebootUnit(BOOT_ID);
+}
+
+void tearDown(void) {
+    delete telemetry;
+    telemetry = NULL;
+}
+
+void test_not_started_without_port_or_key() {
+    UdpTelemetry disabled;
+    TEST_ASSERT_FALSE(disabled.begin(0U, KEY, BOOT_ID));
+    TEST_ASSERT_FALSE(disabled.begin(PORT, "", BOOT_ID));
+    TEST_ASSERT_FALSE(disabled.isRunning());
+    TEST_ASSERT_FALSE(disabled.isBeaconDue());
+}
+
+void test_beacon_layout() {
+    TEST_ASSERT_TRUE(telemetry->isBeaconDue());
+    nativeMillis = 65000UL;
+    Sensor sensor = bootSensor(0U);
+    std::vector<uint8_t> packet = beacon(sensor);
+
+    TEST_ASSERT_EQUAL(PORT, WiFiUDP::sent.back().port);
+    TEST_ASSERT_EQUAL(255, WiFiUDP::sent.back().ip[3]);
+    TEST_ASSERT_EQUAL('T', packet[0]);
+    TEST_ASSERT_EQUAL('B', packet[1]);
+    TEST_ASSERT_EQUAL(UDP_TELEMETRY_VERSION, packet[2]);
+    TEST_ASSERT_EQUAL(UDP_TELEMETRY_TYPE_BEACON, packet[3]);
+    TEST_ASSERT_EQUAL(0x01 | 0x02, packet[4]);
+    TEST_ASSERT_EQUAL_HEX32(BOOT_ID, get32(packet.data() + 8));
+    TEST_ASSERT_EQUAL(1U, get32(packet.data() + 12));
+    TEST_ASSERT_EQUAL(65U, get32(packet.data() + 16));
+    TEST_ASSERT_EQUAL(7160, (int16_t) (packet[20] | (packet[21] << 8)));
+
+    // The next is only due a period later...
+    TEST_ASSERT_FALSE(telemetry->isBeaconDue());
+    nativeMillis += UDP_TELEMETRY_BEACON_PERIOD_MS;
+    TEST_ASSERT_TRUE(telemetry->isBeaconDue());
+    beacon(sensor);
+    TEST_ASSERT_EQUAL(2U, sensor.beaconSequence);
+}
+
+void test_reading_is_accepted() {
+    Sensor sensor = bootSensor(1U);
+    beacon(sensor);
+    send(reading(sensor, 'F', 7160));
+    send(reading(sensor, 'C', 2200));
+
+    TEST_ASSERT_EQUAL(2U, handled.size());
+    TEST_ASSERT_EQUAL(1U, handledSensors[0]);
+    TEST_ASSERT_EQUAL(7160, handled[0]);
+    TEST_ASSERT_EQUAL(7160, handled[1]);
+    TEST_ASSERT_EQUAL(2UL, telemetry->getAcceptedCount());
+}
+
+void test_bad_mac_is_dropped() {
+    Sensor sensor = bootSensor(0U);
+    beacon(sensor);
+    std::vector<uint8_t> packet = reading(sensor, 'F', 7160);
+    packet[20] ^= 0x01U;
+    send(packet);
+
+    TEST_ASSERT_EQUAL(0U, handled.size());
+    TEST_ASSERT_EQUAL(1UL, telemetry->getBadMacCount());
+}
+
+void test_malformed_is_dropped() {
+    Sensor sensor = bootSensor(0U);
+    beacon(sensor);
+    std::vector<uint8_t> packet = reading(sensor, 'F', 7160);
+    packet.pop_back();
+    send(packet);
+
+    // A reading in the layout before the boot id was added...
+    packet = reading(sensor, 'F', 7160);
+    packet[2] = 1U;
+    send(packet);
+
+    TEST_ASSERT_EQUAL(0U, handled.size());
+    TEST_ASSERT_EQUAL(2UL, telemetry->getMalformedCount());
+}
+
+void test_replay_within_a_boot_is_dropped() {
+    Sensor sensor = bootSensor(0U);
+    beacon(sensor);
+    std::vector<uint8_t> first = reading(sensor, 'F', 7000);
+    std::vector<uint8_t> second = reading(sensor, 'F', 7100);
+    send(first);
+    send(second);
+    send(first);
+    send(second);
+
+    TEST_ASSERT_EQUAL(2U, handled.size());
+    TEST_ASSERT_EQUAL(2UL, telemetry->getReplayedCount());
+}
+
+void test_replay_after_unit_reboot_is_dropped() {
+    Sensor sensor = bootSensor(0U);
+    beacon(sensor);
+    std::vector<uint8_t> captured = reading(sensor, 'F', 9900);
+    send(captured);
+    TEST_ASSERT_EQUAL(1U, handled.size());
+
+    rebootUnit(BOOT_ID + 1U);
+    send(captured);
+    TEST_ASSERT_EQUAL(1U, handled.size());
+    TEST_ASSERT_EQUAL(1UL, telemetry->getReplayedCount());
+
+    // Until the sensor hears the new boot's beacon its readings are dropped too...
+    send(reading(sensor, 'F', 7000));
+    TEST_ASSERT_EQUAL(1U, handled.size());
+    beacon(sensor);
+    send(reading(sensor, 'F', 7000));
+    TEST_ASSERT_EQUAL(2U, handled.size());
+    TEST_ASSERT_EQUAL(7000, handled[1]);
+}
+
+void test_reading_naming_a_beacon_not_yet_sent_is_dropped() {
+    Sensor sensor = bootSensor(0U);
+    beacon(sensor);
+    sensor.beaconSequence++;
+    send(reading(sensor, 'F', 7000));
+
+    TEST_ASSERT_EQUAL(0U, handled.size());
+    TEST_ASSERT_EQUAL(1UL, telemetry->getReplayedCount());
+}
+
+void test_sensor_reboot_is_accepted() {
+    Sensor sensor = bootSensor(2U);
+    beacon(sensor);
+    std::vector<uint8_t> captured;
+    for (uint8_t i = 0U; i < 5U; i++) {
+        captured = reading(sensor, 'F', 7000);
+        send(captured);
+    }
+    TEST_ASSERT_EQUAL(5U, handled.size());
+
+    // The sensor reboots and counts from one again after the next beacon...
+    sensor = bootSensor(2U);
+    beacon(sensor);
+    send(reading(sensor, 'F', 7200));
+    TEST_ASSERT_EQUAL(6U, handled.size());
+    TEST_ASSERT_EQUAL(7200, handled[5]);
+
+    // While what it sent before its reboot can't be replayed...
+    send(captured);
+    TEST_ASSERT_EQUAL(6U, handled.size());
+    TEST_ASSERT_EQUAL(1UL, telemetry->getReplayedCount());
+}
+
+void test_sensors_are_tracked_apart() {
+    Sensor first = bootSensor(0U);
+    Sensor second = bootSensor(1U);
+    beacon(first);
+    beacon(second);
+    send(reading(first, 'F', 7000));
+    send(reading(first, 'F', 7000));
+    send(reading(second, 'F', 7100));
+
+    TEST_ASSERT_EQUAL(3U, handled.size());
+    TEST_ASSERT_EQUAL(1U, handledSensors[2]);
+    TEST_ASSERT_EQUAL(0UL, telemetry->getReplayedCount());
+}
+
+int main() {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_not_started_without_port_or_key);
+    RUN_TEST(test_beacon_layout);
+    RUN_TEST(test_reading_is_accepted);
+    RUN_TEST(test_bad_mac_is_dropped);
+    RUN_TEST(test_malformed_is_dropped);
+    RUN_TEST(test_replay_within_a_boot_is_dropped);
+    RUN_TEST(test_replay_after_unit_reboot_is_dropped);
+    RUN_TEST(test_reading_naming_a_beacon_not_yet_sent_is_dropped);
+    RUN_TEST(test_sensor_reboot_is_accepted);
+    RUN_TEST(test_sensors_are_tracked_apart);
+
+    return UNITY_END();
+}